@@ -0,0 +1,87 @@
+#ifndef S21_BENCH_H_
+#define S21_BENCH_H_
+
+// Minimal timing and allocation counting shared by the benchmarks. Every
+// benchmark is its own executable, so replacing the global allocation
+// functions here affects only that benchmark.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+#include "../s21_queue/s21_queue.h"
+
+namespace s21_bench {
+inline std::atomic<size_t> allocations{0};
+
+struct Result {
+  double ns_per_op;
+  size_t allocations;
+};
+
+// Runs fn once and reports its cost per operation.
+template <typename F>
+Result Measure(size_t ops, F &&fn) {
+  size_t allocs_before = allocations.load();
+  auto start = std::chrono::steady_clock::now();
+  fn();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  return {ns / ops, allocations.load() - allocs_before};
+}
+
+inline void Report(const char *name, const Result &res) {
+  std::printf("%-48s %10.2f ns/op %12zu allocs\n", name, res.ns_per_op,
+              res.allocations);
+}
+
+// A mutex-guarded s21::queue with the try_push/try_pop interface of the
+// concurrent queues, used as the baseline they replace.
+template <typename T>
+class LockedQueue {
+ public:
+  explicit LockedQueue(size_t) {}
+  bool try_push(const T &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(T &out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<T> queue_;
+};
+
+// Keeps the optimizer from discarding a computed value.
+template <typename T>
+void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+}  // namespace s21_bench
+
+// Kept out of line: once GCC inlines both sides it pairs the malloc in new
+// with the free in delete and reports a false new/delete mismatch.
+__attribute__((noinline)) void *operator new(size_t size) {
+  s21_bench::allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+__attribute__((noinline)) void operator delete(void *ptr, size_t) noexcept {
+  std::free(ptr);
+}
+
+#endif
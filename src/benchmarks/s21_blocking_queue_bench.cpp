@@ -0,0 +1,87 @@
+#include "../s21_blocking_queue/s21_blocking_queue.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr int kItems = 1 << 20;
+
+// The per-item hand-off we use today: s21::queue under a mutex, one lock
+// and one notification for every element on both sides.
+class PerItemQueue {
+ public:
+  void push(int value) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push(value);
+    }
+    not_empty_.notify_one();
+  }
+  bool pop(int &out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return !queue_.empty() || closed_; });
+    if (queue_.empty()) return false;
+    out = queue_.front();
+    queue_.pop();
+    return true;
+  }
+  void close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+    }
+    not_empty_.notify_all();
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  s21::queue<int> queue_;
+  bool closed_ = false;
+};
+
+void PerItem() {
+  PerItemQueue q;
+  auto res = s21_bench::Measure(kItems, [&] {
+    std::thread consumer([&] {
+      int value;
+      long sum = 0;
+      while (q.pop(value)) sum += value;
+      s21_bench::DoNotOptimize(sum);
+    });
+    for (int i = 0; i < kItems; ++i) q.push(i);
+    q.close();
+    consumer.join();
+  });
+  s21_bench::Report("mutex + s21::queue, per item", res);
+}
+
+void Bulk(size_t batch) {
+  s21::blocking_queue<int> q(1024);
+  auto res = s21_bench::Measure(kItems, [&] {
+    std::thread consumer([&] {
+      int buf[256];
+      long sum = 0;
+      while (size_t n = q.pop_bulk(buf, batch))
+        for (size_t i = 0; i < n; ++i) sum += buf[i];
+      s21_bench::DoNotOptimize(sum);
+    });
+    for (int i = 0; i < kItems; ++i) q.push(i);
+    q.close();
+    consumer.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "blocking_queue, pop_bulk(%zu)", batch);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  PerItem();
+  for (size_t batch : {1, 16, 256}) Bulk(batch);
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include "../s21_buffer_queue/s21_buffer_queue.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_queue/s21_queue.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kFlushes = 4096;
+constexpr size_t kPerFlush = 64;
+
+// /dev/null keeps the device out of the measurement: what is left is the
+// copying and the syscalls of the two egress paths. Both pay the same for
+// copying the payloads into their queue.
+int OpenScratch() { return ::open("/dev/null", O_WRONLY); }
+
+// Today's egress path: copy the queued buffers into one contiguous block
+// and write() it.
+void Coalesce(const std::vector<std::string> &payloads) {
+  int fd = OpenScratch();
+  std::string block;
+  auto res = s21_bench::Measure(kFlushes * kPerFlush, [&] {
+    s21::queue<std::string> q;
+    for (size_t f = 0; f < kFlushes; ++f) {
+      for (size_t i = 0; i < kPerFlush; ++i) q.push(payloads[i]);
+      block.clear();
+      while (!q.empty()) {
+        block += q.front();
+        q.pop();
+      }
+      for (size_t done = 0; done < block.size();) {
+        ssize_t n = ::write(fd, block.data() + done, block.size() - done);
+        if (n < 0) return;
+        done += static_cast<size_t>(n);
+      }
+    }
+  });
+  s21_bench::Report("s21::queue + copy + write", res);
+  ::close(fd);
+}
+
+void Gather(const std::vector<std::string> &payloads) {
+  int fd = OpenScratch();
+  auto res = s21_bench::Measure(kFlushes * kPerFlush, [&] {
+    s21::buffer_queue q;
+    for (size_t f = 0; f < kFlushes; ++f) {
+      for (size_t i = 0; i < kPerFlush; ++i) q.push(payloads[i]);
+      while (!q.empty()) q.drain_to(fd);
+    }
+  });
+  s21_bench::Report("buffer_queue + writev", res);
+  ::close(fd);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 gen(2);
+  std::vector<std::string> payloads;
+  for (size_t i = 0; i < kPerFlush; ++i)
+    payloads.emplace_back(256 + gen() % 4096, 'x');
+  Coalesce(payloads);
+  Gather(payloads);
+  return 0;
+}
@@ -0,0 +1,53 @@
+#include "../s21_chunk_list/s21_chunk_list.h"
+
+#include <chrono>
+#include <cstdio>
+
+#include "../s21_stack/s21_stack.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kDepth = 1 << 22;
+
+struct Frame {
+  int node = 0;
+  int edge = 0;
+  long cost = 0;
+};
+
+// A DFS that dives to kDepth and unwinds, twice. Besides the mean cost the
+// slowest single push is reported: with the vector backing it is the push
+// that triggers the largest reallocation.
+template <typename Stack>
+void DeepDfs(const char *name) {
+  long worst_ns = 0;
+  auto res = s21_bench::Measure(kDepth * 4L, [&] {
+    Stack stack;
+    for (int round = 0; round < 2; ++round) {
+      for (int i = 0; i < kDepth; ++i) {
+        auto start = std::chrono::steady_clock::now();
+        stack.push(Frame{i, 0, i * 2L});
+        long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        if (ns > worst_ns) worst_ns = ns;
+      }
+      long sum = 0;
+      while (!stack.empty()) {
+        sum += stack.top().cost;
+        stack.pop();
+      }
+      s21_bench::DoNotOptimize(sum);
+    }
+  });
+  s21_bench::Report(name, res);
+  std::printf("  slowest push %.2f ms\n", worst_ns / 1e6);
+}
+}  // namespace
+
+int main() {
+  DeepDfs<s21::stack<Frame>>("s21::stack<Frame> (vector)");
+  DeepDfs<s21::stack<Frame, s21::chunk_list<Frame>>>(
+      "s21::stack<Frame, chunk_list>");
+  return 0;
+}
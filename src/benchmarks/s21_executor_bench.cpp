@@ -0,0 +1,119 @@
+#include "../s21_executor/s21_executor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../s21_queue/s21_queue.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kElements = 1 << 21;
+constexpr size_t kCutoff = 2048;
+
+// Today's setup: every task of every job goes through one locked
+// s21::queue, and a waiting thread helps by running whatever is at its
+// front.
+class SharedQueuePool {
+ public:
+  explicit SharedQueuePool(size_t threads) : stop_(false) {
+    for (size_t i = 0; i < threads; ++i)
+      threads_.emplace_back([this] {
+        while (!stop_.load()) {
+          if (!RunOne()) std::this_thread::yield();
+        }
+      });
+  }
+  ~SharedQueuePool() {
+    stop_.store(true);
+    for (auto &thread : threads_) thread.join();
+  }
+
+  class Group {
+   public:
+    explicit Group(SharedQueuePool &pool) : pool_(pool), pending_(0) {}
+    void spawn(std::function<void()> fn) {
+      pending_.fetch_add(1);
+      std::lock_guard<std::mutex> lock(pool_.mutex_);
+      pool_.tasks_.push([this, fn] {
+        fn();
+        pending_.fetch_sub(1);
+      });
+    }
+    void wait() {
+      while (pending_.load() != 0)
+        if (!pool_.RunOne()) std::this_thread::yield();
+    }
+
+   private:
+    SharedQueuePool &pool_;
+    std::atomic<size_t> pending_;
+  };
+
+ private:
+  std::mutex mutex_;
+  s21::queue<std::function<void()>> tasks_;
+  std::atomic<bool> stop_;
+  std::vector<std::thread> threads_;
+
+  bool RunOne() {
+    std::function<void()> task;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (tasks_.empty()) return false;
+      task = tasks_.front();
+      tasks_.pop();
+    }
+    task();
+    return true;
+  }
+};
+
+using StealingGroup = s21::task_group;
+using SharedGroup = SharedQueuePool::Group;
+
+template <typename Group, typename Pool>
+void QuickSort(Pool &pool, int *first, int *last) {
+  while (static_cast<size_t>(last - first) > kCutoff) {
+    int pivot = first[(last - first) / 2];
+    int *mid = std::partition(first, last, [&](int v) { return v < pivot; });
+    int *high = std::partition(mid, last, [&](int v) { return v == pivot; });
+    Group group(pool);
+    group.spawn([&pool, high, last] { QuickSort<Group>(pool, high, last); });
+    QuickSort<Group>(pool, first, mid);
+    group.wait();
+    return;
+  }
+  std::sort(first, last);
+}
+
+template <typename Group, typename Pool>
+void Sort(const char *name, size_t threads, const std::vector<int> &input) {
+  Pool pool(threads);
+  std::vector<int> data;
+  auto res = s21_bench::Measure(kElements, [&] {
+    data = input;
+    QuickSort<Group>(pool, data.data(), data.data() + data.size());
+  });
+  if (!std::is_sorted(data.begin(), data.end())) std::printf("not sorted\n");
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zu workers", name, threads);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 gen(11);
+  std::vector<int> input(kElements);
+  for (int &v : input) v = static_cast<int>(gen());
+  for (size_t threads : {1, 2, 4}) {
+    Sort<SharedGroup, SharedQueuePool>("shared s21::queue", threads, input);
+    Sort<StealingGroup, s21::executor>("s21::executor", threads, input);
+  }
+  return 0;
+}
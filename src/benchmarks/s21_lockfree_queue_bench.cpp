@@ -0,0 +1,67 @@
+#include "../s21_lockfree_queue/s21_lockfree_queue.h"
+
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kBurst = 4096;
+constexpr size_t kBursts = 64;
+
+void Push(s21_bench::LockedQueue<int> &q, int value) { q.try_push(value); }
+void Push(s21::lockfree_queue<int> &q, int value) { q.push(value); }
+
+// Producers push whole bursts while consumers drain them, so the queue
+// depth swings between empty and several bursts. The allocation column
+// shows whether the steady state still goes to the allocator.
+template <typename Queue>
+void BurstyIngest(const char *name, size_t producers, size_t consumers) {
+  Queue q(0);
+  size_t total = kBurst * kBursts * producers;
+  auto res = s21_bench::Measure(total * 2, [&] {
+    std::atomic<size_t> consumed{0};
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+      threads.emplace_back([&q] {
+        for (size_t b = 0; b < kBursts; ++b) {
+          for (size_t i = 0; i < kBurst; ++i) Push(q, static_cast<int>(i));
+          std::this_thread::yield();
+        }
+      });
+    }
+    for (size_t c = 0; c < consumers; ++c) {
+      threads.emplace_back([&q, &consumed, total] {
+        int value;
+        long sum = 0;
+        while (consumed.load(std::memory_order_relaxed) < total) {
+          if (q.try_pop(value)) {
+            sum += value;
+            consumed.fetch_add(1, std::memory_order_relaxed);
+          } else {
+            std::this_thread::yield();
+          }
+        }
+        s21_bench::DoNotOptimize(sum);
+      });
+    }
+    for (auto &thread : threads) thread.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zuP/%zuC", name, producers,
+                consumers);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  for (size_t threads : {1, 2, 4}) {
+    BurstyIngest<s21_bench::LockedQueue<int>>("mutex + s21::queue", threads,
+                                              threads);
+    BurstyIngest<s21::lockfree_queue<int>>("lockfree_queue", threads,
+                                           threads);
+  }
+  return 0;
+}
@@ -0,0 +1,115 @@
+#include "../s21_lockfree_stack/s21_lockfree_stack.h"
+
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../s21_stack/s21_stack.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kBuffers = 256;
+constexpr size_t kRounds = 1 << 16;
+
+// Today's shared free list.
+class LockedStack {
+ public:
+  explicit LockedStack(size_t) {}
+  void push(char *value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stack_.push(value);
+  }
+  bool try_pop(char *&out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (stack_.empty()) return false;
+    out = stack_.top();
+    stack_.pop();
+    return true;
+  }
+  template <typename Fn>
+  size_t pop_all(Fn &&fn) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    for (; !stack_.empty(); ++n) {
+      fn(stack_.top());
+      stack_.pop();
+    }
+    return n;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::stack<char *> stack_;
+};
+
+// Every thread repeatedly borrows a buffer from the shared free list,
+// touches it and hands it back.
+template <typename Stack>
+void FreeList(const char *name, size_t threads) {
+  std::vector<std::vector<char>> buffers(kBuffers, std::vector<char>(64));
+  Stack free_list(kBuffers);
+  auto res = s21_bench::Measure(kRounds * threads * 2, [&] {
+    for (auto &buffer : buffers) free_list.push(buffer.data());
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&free_list] {
+        char *buffer = nullptr;
+        for (size_t i = 0; i < kRounds; ++i) {
+          while (!free_list.try_pop(buffer)) std::this_thread::yield();
+          ++buffer[0];
+          free_list.push(buffer);
+        }
+      });
+    }
+    for (auto &worker : workers) worker.join();
+    free_list.pop_all([](char *) {});
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zu threads", name, threads);
+  s21_bench::Report(label, res);
+}
+
+// Producers return buffers one at a time; a single collector takes
+// whatever has accumulated in one go.
+template <typename Stack>
+void BatchCollect(const char *name, size_t producers) {
+  std::vector<char> buffer(64);
+  Stack done(0);
+  size_t total = kRounds * producers;
+  auto res = s21_bench::Measure(total * 2, [&] {
+    std::atomic<size_t> collected{0};
+    std::vector<std::thread> threads;
+    for (size_t p = 0; p < producers; ++p) {
+      threads.emplace_back([&] {
+        for (size_t i = 0; i < kRounds; ++i) done.push(buffer.data());
+      });
+    }
+    threads.emplace_back([&] {
+      while (collected.load(std::memory_order_relaxed) < total) {
+        size_t n = done.pop_all([](char *b) { s21_bench::DoNotOptimize(b); });
+        if (n == 0) std::this_thread::yield();
+        collected.fetch_add(n, std::memory_order_relaxed);
+      }
+    });
+    for (auto &thread : threads) thread.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s pop_all, %zuP/1C", name,
+                producers);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  for (size_t threads : {1, 2, 4}) {
+    FreeList<LockedStack>("mutex + s21::stack", threads);
+    FreeList<s21::lockfree_stack<char *>>("lockfree_stack", threads);
+  }
+  for (size_t producers : {1, 3}) {
+    BatchCollect<LockedStack>("mutex + s21::stack", producers);
+    BatchCollect<s21::lockfree_stack<char *>>("lockfree_stack", producers);
+  }
+  return 0;
+}
@@ -0,0 +1,90 @@
+#include "../s21_monotonic_queue/s21_monotonic_queue.h"
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_deque/s21_deque.h"
+#include "../s21_window_aggregator/s21_window_aggregator.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kWindow = 100000;
+constexpr size_t kTicks = 1 << 20;
+// Rescanning is five orders of magnitude slower; fewer ticks suffice.
+constexpr size_t kRescanTicks = 1 << 11;
+
+// Each tick slides the window by one sample and reads min and max.
+// Today's detector keeps the window in the deque behind s21::queue and
+// rescans it.
+void Rescan(const std::vector<int> &samples) {
+  s21::deque<int> window;
+  for (size_t i = 0; i < kWindow; ++i) window.push_back(samples[i]);
+  auto res = s21_bench::Measure(kRescanTicks, [&] {
+    long spread = 0;
+    for (size_t t = 0; t < kRescanTicks; ++t) {
+      window.pop_front();
+      window.push_back(samples[kWindow + t]);
+      int lo = window[0], hi = window[0];
+      for (int v : window) {
+        lo = v < lo ? v : lo;
+        hi = v > hi ? v : hi;
+      }
+      spread += hi - lo;
+    }
+    s21_bench::DoNotOptimize(spread);
+  });
+  s21_bench::Report("rescan s21::deque", res);
+}
+
+void Monotonic(const std::vector<int> &samples) {
+  s21::monotonic_queue<int> window;
+  for (size_t i = 0; i < kWindow; ++i) window.push(samples[i]);
+  auto res = s21_bench::Measure(kTicks, [&] {
+    long spread = 0;
+    for (size_t t = 0; t < kTicks; ++t) {
+      window.pop();
+      window.push(samples[kWindow + t]);
+      spread += window.max() - window.min();
+    }
+    s21_bench::DoNotOptimize(spread);
+  });
+  s21_bench::Report("monotonic_queue", res);
+}
+
+struct Range {
+  int lo = 0, hi = 0;
+};
+struct MergeRange {
+  Range operator()(const Range &a, const Range &b) const {
+    return {a.lo < b.lo ? a.lo : b.lo, a.hi > b.hi ? a.hi : b.hi};
+  }
+};
+
+void TwoStacks(const std::vector<int> &samples) {
+  s21::window_aggregator<Range, MergeRange> window;
+  for (size_t i = 0; i < kWindow; ++i) window.push({samples[i], samples[i]});
+  auto res = s21_bench::Measure(kTicks, [&] {
+    long spread = 0;
+    for (size_t t = 0; t < kTicks; ++t) {
+      int v = samples[kWindow + t];
+      window.pop();
+      window.push({v, v});
+      Range r = window.query();
+      spread += r.hi - r.lo;
+    }
+    s21_bench::DoNotOptimize(spread);
+  });
+  s21_bench::Report("window_aggregator<min/max>", res);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 gen(4);
+  std::vector<int> samples(kWindow + kTicks);
+  for (int &v : samples) v = static_cast<int>(gen() % 100000);
+  Rescan(samples);
+  Monotonic(samples);
+  TwoStacks(samples);
+  return 0;
+}
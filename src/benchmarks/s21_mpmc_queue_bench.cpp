@@ -0,0 +1,46 @@
+#include "../s21_mpmc_queue/s21_mpmc_queue.h"
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kTotalOps = 1 << 20;
+
+// Every thread alternates push and pop, so the load is many-to-many at any
+// thread count and the queue never stays full or empty for long.
+template <typename Queue>
+void Contention(const char *name, size_t threads) {
+  Queue q(1024);
+  size_t per_thread = kTotalOps / threads;
+  auto res = s21_bench::Measure(per_thread * threads * 2, [&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&q, per_thread] {
+        int value;
+        long sum = 0;
+        for (size_t i = 0; i < per_thread; ++i) {
+          while (!q.try_push(static_cast<int>(i))) std::this_thread::yield();
+          while (!q.try_pop(value)) std::this_thread::yield();
+          sum += value;
+        }
+        s21_bench::DoNotOptimize(sum);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zu threads", name, threads);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  for (size_t threads = 1; threads <= 64; threads *= 2) {
+    Contention<s21_bench::LockedQueue<int>>("mutex + s21::queue", threads);
+    Contention<s21::mpmc_queue<int>>("mpmc_queue", threads);
+  }
+  return 0;
+}
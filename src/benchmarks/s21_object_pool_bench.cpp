@@ -0,0 +1,60 @@
+#include "../s21_object_pool/s21_object_pool.h"
+
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kRounds = 2000;
+constexpr size_t kLive = 512;
+
+struct Request {
+  explicit Request(size_t i) : id(i) {}
+  size_t id;
+  char headers[120];
+};
+
+struct HeapAlloc {
+  Request *create(size_t i) { return new Request(i); }
+  void destroy(Request *r) { delete r; }
+};
+
+// Every thread keeps a window of kLive requests in flight and replaces
+// them in waves, as a server does under steady load.
+template <typename Alloc>
+void Churn(const char *name, size_t threads) {
+  Alloc alloc;
+  auto res = s21_bench::Measure(kRounds * kLive * threads, [&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&alloc] {
+        std::vector<Request *> live(kLive, nullptr);
+        size_t sum = 0;
+        for (size_t round = 0; round < kRounds; ++round) {
+          for (size_t i = 0; i < kLive; ++i) {
+            if (live[i] != nullptr) alloc.destroy(live[i]);
+            live[i] = alloc.create(round + i);
+            sum += live[i]->id;
+          }
+        }
+        for (Request *r : live) alloc.destroy(r);
+        s21_bench::DoNotOptimize(sum);
+      });
+    }
+    for (auto &worker : workers) worker.join();
+  });
+  char label[64];
+  std::snprintf(label, sizeof(label), "%s, %zu threads", name, threads);
+  s21_bench::Report(label, res);
+}
+}  // namespace
+
+int main() {
+  for (size_t threads : {1, 4}) {
+    Churn<HeapAlloc>("new/delete", threads);
+    Churn<s21::object_pool<Request>>("object_pool", threads);
+  }
+  return 0;
+}
@@ -0,0 +1,108 @@
+#include "../s21_pairing_heap/s21_pairing_heap.h"
+
+#include <cstdio>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_priority_queue/s21_priority_queue.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr int kVertices = 1 << 17;
+constexpr int kDegree = 8;
+constexpr long kInf = std::numeric_limits<long>::max();
+
+struct Graph {
+  std::vector<int> first;  // Edges of v are [first[v], first[v + 1]).
+  std::vector<int> to;
+  std::vector<int> weight;
+};
+
+Graph RandomGraph() {
+  std::mt19937 gen(5);
+  Graph g;
+  for (int v = 0; v < kVertices; ++v) {
+    g.first.push_back(static_cast<int>(g.to.size()));
+    for (int e = 0; e < kDegree; ++e) {
+      g.to.push_back(static_cast<int>(gen() % kVertices));
+      g.weight.push_back(static_cast<int>(gen() % 1000 + 1));
+    }
+  }
+  g.first.push_back(static_cast<int>(g.to.size()));
+  return g;
+}
+
+// Today's approach: push a duplicate entry on every improvement and skip
+// stale entries when they surface.
+void LazyDeletion(const Graph &g) {
+  size_t peak = 0;
+  auto res = s21_bench::Measure(g.to.size(), [&] {
+    std::vector<long> dist(kVertices, kInf);
+    using Entry = std::pair<long, int>;
+    s21::priority_queue<Entry, s21::vector<Entry>, std::greater<Entry>> q;
+    dist[0] = 0;
+    q.push({0, 0});
+    while (!q.empty()) {
+      Entry top = q.top();
+      q.pop();
+      if (top.first != dist[top.second]) continue;
+      for (int e = g.first[top.second]; e < g.first[top.second + 1]; ++e) {
+        long candidate = top.first + g.weight[e];
+        if (candidate < dist[g.to[e]]) {
+          dist[g.to[e]] = candidate;
+          q.push({candidate, g.to[e]});
+          if (q.size() > peak) peak = q.size();
+        }
+      }
+    }
+    s21_bench::DoNotOptimize(dist[kVertices - 1]);
+  });
+  s21_bench::Report("priority_queue + stale entries", res);
+  std::printf("  peak heap size %zu\n", peak);
+}
+
+void DecreaseKey(const Graph &g) {
+  size_t peak = 0;
+  auto res = s21_bench::Measure(g.to.size(), [&] {
+    using Entry = std::pair<long, int>;
+    using Heap = s21::pairing_heap<Entry>;
+    std::vector<long> dist(kVertices, kInf);
+    std::vector<Heap::handle> where(kVertices);
+    std::vector<bool> queued(kVertices, false);
+    Heap heap;
+    dist[0] = 0;
+    where[0] = heap.push({0, 0});
+    queued[0] = true;
+    while (!heap.empty()) {
+      Entry top = heap.top();
+      heap.pop();
+      queued[top.second] = false;
+      for (int e = g.first[top.second]; e < g.first[top.second + 1]; ++e) {
+        int v = g.to[e];
+        long candidate = top.first + g.weight[e];
+        if (candidate >= dist[v]) continue;
+        dist[v] = candidate;
+        if (queued[v]) {
+          heap.decrease_key(where[v], {candidate, v});
+        } else {
+          where[v] = heap.push({candidate, v});
+          queued[v] = true;
+        }
+        if (heap.size() > peak) peak = heap.size();
+      }
+    }
+    s21_bench::DoNotOptimize(dist[kVertices - 1]);
+  });
+  s21_bench::Report("pairing_heap + decrease_key", res);
+  std::printf("  peak heap size %zu\n", peak);
+}
+}  // namespace
+
+int main() {
+  Graph g = RandomGraph();
+  LazyDeletion(g);
+  DecreaseKey(g);
+  return 0;
+}
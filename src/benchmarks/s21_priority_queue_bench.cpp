@@ -0,0 +1,99 @@
+#include "../s21_priority_queue/s21_priority_queue.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "../s21_set/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kElements = 1 << 16;
+constexpr size_t kTopK = 64;
+
+// Distinct keys, because the set-based emulation cannot hold duplicates.
+std::vector<int> Keys() {
+  std::vector<int> keys(kElements);
+  for (size_t i = 0; i < kElements; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(42));
+  return keys;
+}
+
+// What we do today: a node-based ordered set, popping its largest key
+// (end() is the largest element of an s21::set).
+void SetEmulation(const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size() * 2, [&] {
+    s21::set<int> set;
+    for (int key : keys) set.insert(key);
+    long sum = 0;
+    while (!set.empty()) {
+      auto it = set.end();
+      sum += *it;
+      set.erase(it);
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("s21::set emulation, push + pop all", res);
+}
+
+template <size_t Arity>
+void PushPop(const char *name, const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size() * 2, [&] {
+    s21::priority_queue<int, s21::vector<int>, std::less<int>, Arity> q;
+    for (int key : keys) q.push(key);
+    long sum = 0;
+    while (!q.empty()) {
+      sum += q.top();
+      q.pop();
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report(name, res);
+}
+
+void Heapify(const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size(), [&] {
+    s21::priority_queue<int> q(keys.begin(), keys.end());
+    s21_bench::DoNotOptimize(q.top());
+  });
+  s21_bench::Report("priority_queue<4>, heapify", res);
+}
+
+// The k smallest keys of a stream, as a max-heap of size k.
+void TopKSet(const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size(), [&] {
+    s21::set<int> set;
+    for (size_t i = 0; i < kTopK; ++i) set.insert(keys[i]);
+    for (size_t i = kTopK; i < keys.size(); ++i) {
+      if (keys[i] < *set.end()) {
+        set.erase(set.end());
+        set.insert(keys[i]);
+      }
+    }
+    s21_bench::DoNotOptimize(*set.end());
+  });
+  s21_bench::Report("s21::set emulation, top-64 stream", res);
+}
+
+void TopKHeap(const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size(), [&] {
+    s21::priority_queue<int> q(keys.begin(), keys.begin() + kTopK);
+    for (size_t i = kTopK; i < keys.size(); ++i)
+      if (keys[i] < q.top()) q.replace_top(keys[i]);
+    s21_bench::DoNotOptimize(q.top());
+  });
+  s21_bench::Report("priority_queue<4>, top-64 stream", res);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys = Keys();
+  SetEmulation(keys);
+  PushPop<2>("priority_queue<2>, push + pop all", keys);
+  PushPop<4>("priority_queue<4>, push + pop all", keys);
+  Heapify(keys);
+  TopKSet(keys);
+  TopKHeap(keys);
+  return 0;
+}
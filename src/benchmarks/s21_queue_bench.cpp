@@ -0,0 +1,55 @@
+#include "../s21_queue/s21_queue.h"
+#include "s21_bench.h"
+
+#include <list>
+
+namespace {
+constexpr size_t kOps = 1000000;
+constexpr size_t kWindow = 1024;
+
+template <typename Queue>
+void FillAndDrain(const char *name) {
+  Queue q;
+  auto res = s21_bench::Measure(2 * kOps, [&q] {
+    for (size_t i = 0; i < kOps; ++i) q.push(static_cast<int>(i));
+    long sum = 0;
+    while (!q.empty()) {
+      sum += q.front();
+      q.pop();
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report(name, res);
+}
+
+template <typename Queue>
+void RollingWindow(const char *name) {
+  Queue q;
+  for (size_t i = 0; i < kWindow; ++i) q.push(static_cast<int>(i));
+  auto res = s21_bench::Measure(kOps, [&q] {
+    long sum = 0;
+    for (size_t i = 0; i < kOps; ++i) {
+      q.push(static_cast<int>(i));
+      sum += q.front();
+      q.pop();
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report(name, res);
+}
+}  // namespace
+
+int main() {
+  // s21::list keeps freed nodes in its blocks until it is cleared, so it
+  // allocates least but holds on to its peak size; std::list stands in for
+  // a list that allocates and frees one node per element.
+  FillAndDrain<s21::queue<int, std::list<int>>>("queue<std::list> fill+drain");
+  FillAndDrain<s21::queue<int, s21::list<int>>>("queue<list> fill+drain");
+  FillAndDrain<s21::queue<int, s21::deque<int>>>("queue<deque> fill+drain");
+  RollingWindow<s21::queue<int, std::list<int>>>(
+      "queue<std::list> rolling window");
+  RollingWindow<s21::queue<int, s21::list<int>>>("queue<list> rolling window");
+  RollingWindow<s21::queue<int, s21::deque<int>>>(
+      "queue<deque> rolling window");
+  return 0;
+}
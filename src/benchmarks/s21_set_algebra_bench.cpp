@@ -0,0 +1,69 @@
+#include "../s21_set_algebra/s21_set_algebra.h"
+
+#include <cstdio>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kKeys = 1 << 20;
+constexpr size_t kFewKeys = 1000;
+
+s21::set<int> RandomSet(std::mt19937 &gen, size_t n) {
+  std::vector<int> keys(n);
+  for (int &key : keys) key = static_cast<int>(gen() % (4 * kKeys));
+  return s21::set<int>(keys.begin(), keys.end());
+}
+
+// Today's approach: walk one set and probe the other.
+s21::set<int> ProbeIntersection(const s21::set<int> &a,
+                                const s21::set<int> &b) {
+  s21::set<int> out;
+  for (auto it = a.begin(); it != s21::set<int>::iterator(); ++it)
+    if (b.contains(*it)) out.insert(*it);
+  return out;
+}
+
+s21::set<int> ProbeUnion(const s21::set<int> &a, const s21::set<int> &b) {
+  s21::set<int> out(a);
+  for (auto it = b.begin(); it != s21::set<int>::iterator(); ++it)
+    if (!a.contains(*it)) out.insert(*it);
+  return out;
+}
+
+void Row(const char *name, size_t ops,
+         const std::function<s21::set<int>()> &fn) {
+  auto res = s21_bench::Measure(ops, [&] {
+    s21::set<int> out = fn();
+    s21_bench::DoNotOptimize(out);
+  });
+  s21_bench::Report(name, res);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 gen(49);
+  s21::set<int> a = RandomSet(gen, kKeys);
+  s21::set<int> b = RandomSet(gen, kKeys);
+  s21::set<int> few = RandomSet(gen, kFewKeys);
+  s21::executor ex;
+  std::printf("%zu worker(s); ns per element of the inputs\n", ex.size());
+  size_t both = a.size() + b.size();
+  Row("intersection, walk + contains", both,
+      [&] { return ProbeIntersection(a, b); });
+  Row("set_intersection", both, [&] { return s21::set_intersection(a, b); });
+  Row("set_intersection, executor", both,
+      [&] { return s21::set_intersection(ex, a, b); });
+  Row("union, copy + walk + insert", both, [&] { return ProbeUnion(a, b); });
+  Row("set_union", both, [&] { return s21::set_union(a, b); });
+  Row("set_union, executor", both,
+      [&] { return s21::set_union(ex, a, b); });
+  size_t skewed = a.size() + few.size();
+  Row("1000 & 2^20 keys, walk + contains", skewed,
+      [&] { return ProbeIntersection(a, few); });
+  Row("1000 & 2^20 keys, set_intersection", skewed,
+      [&] { return s21::set_intersection(a, few); });
+  return 0;
+}
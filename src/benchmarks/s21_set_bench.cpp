@@ -0,0 +1,233 @@
+#include "../s21_set/s21_set.h"
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "../s21_map/s21_map.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kKeys = 1 << 17;
+constexpr size_t kLookupKeys = 1000000;
+constexpr size_t kScans = 16;
+
+// Random inserts, then draining from the smallest key: every insert and
+// erase walks and rebalances one root-to-leaf path.
+template <typename Set>
+void InsertErase(const char *name, const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(2 * keys.size(), [&] {
+    Set set;
+    for (int key : keys) set.insert(key);
+    while (!set.empty()) set.erase(set.begin());
+    s21_bench::DoNotOptimize(set);
+  });
+  s21_bench::Report(name, res);
+}
+
+void MapInsert(const std::vector<int> &keys) {
+  auto res = s21_bench::Measure(keys.size(), [&] {
+    s21::map<int, double> map;
+    for (int key : keys) map.insert(key, key * 0.5);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map insert", res);
+  res = s21_bench::Measure(keys.size(), [&] {
+    std::map<int, double> map;
+    for (int key : keys) map.emplace(key, key * 0.5);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("std::map insert", res);
+}
+// Keyed lookups in a set of kLookupKeys keys. The old set::find checked
+// contains() and then walked from begin(), so only a few of those fit.
+void Lookup(const std::vector<int> &keys) {
+  s21::set<int> set;
+  std::set<int> std_set;
+  for (int key : keys) {
+    set.insert(key);
+    std_set.insert(key);
+  }
+  auto res = s21_bench::Measure(kScans, [&] {
+    long sum = 0;
+    for (size_t i = 0; i < kScans; ++i) {
+      if (!set.contains(keys[i])) continue;
+      auto it = set.begin();
+      while (*it != keys[i]) ++it;
+      sum += *it;
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("s21::set contains + scan (old find)", res);
+  res = s21_bench::Measure(keys.size(), [&] {
+    long sum = 0;
+    for (int key : keys) sum += *set.find(key);
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("s21::set find", res);
+  res = s21_bench::Measure(keys.size(), [&] {
+    long sum = 0;
+    for (int key : keys) sum += *std_set.find(key);
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("std::set find", res);
+}
+
+void MapIndex(const std::vector<int> &keys) {
+  s21::map<int, long> map;
+  for (int key : keys) map.insert(key, 0);
+  auto res = s21_bench::Measure(keys.size(), [&] {
+    for (int key : keys) ++map[key];
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map operator[], existing keys", res);
+}
+// p50/p90/p99 of a latency map, by walking from begin() and by
+// nth_element.
+void Percentiles(const std::vector<int> &keys) {
+  s21::map<int, long, s21::order_stats::on> map;
+  for (int key : keys) map.insert(key, key);
+  const size_t ranks[] = {keys.size() / 2, keys.size() * 9 / 10,
+                          keys.size() * 99 / 100};
+  auto res = s21_bench::Measure(3 * kScans, [&] {
+    long sum = 0;
+    for (size_t i = 0; i < kScans; ++i) {
+      for (size_t rank : ranks) {
+        auto it = map.begin();
+        it += rank;
+        sum += it->second;
+      }
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("s21::map percentile, walk from begin", res);
+  res = s21_bench::Measure(3 * keys.size(), [&] {
+    long sum = 0;
+    for (size_t i = 0; i < keys.size(); ++i)
+      for (size_t rank : ranks) sum += map.nth_element(rank)->second;
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("s21::map percentile, nth_element", res);
+}
+// Loading and copying a map of kLookupKeys sorted entries.
+void BulkLoad() {
+  std::vector<std::pair<int, long>> entries(kLookupKeys);
+  for (size_t i = 0; i < kLookupKeys; ++i)
+    entries[i] = {static_cast<int>(i), static_cast<long>(i)};
+  auto res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map;
+    for (const auto &entry : entries) map.insert(entry);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map load, insert each", res);
+  res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map(entries.begin(), entries.end());
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map load, sorted range", res);
+  s21::map<int, long> source(entries.begin(), entries.end());
+  res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map;
+    for (auto it = source.begin(); it != s21::map<int, long>::iterator(); ++it)
+      map.insert(*it);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map copy, insert each (old copy)", res);
+  res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map(source);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map copy, structural clone", res);
+}
+// Splits at spread out keys and joins back. Without order statistics the
+// split also walks the smaller half to learn the sizes.
+template <typename Map>
+void SplitJoin(const char *name,
+               const std::vector<std::pair<int, long>> &entries) {
+  Map map(entries.begin(), entries.end());
+  auto res = s21_bench::Measure(1000, [&] {
+    for (int i = 0; i < 1000; ++i) {
+      Map upper = map.split(i * 997 % kLookupKeys);
+      map.join(upper);
+    }
+  });
+  s21_bench::Report(name, res);
+}
+// Re-sharding: two interleaved maps of kLookupKeys / 2 entries each are
+// merged, then the result is split in half and joined back.
+void Reshard() {
+  std::vector<std::pair<int, long>> even, odd;
+  for (size_t i = 0; i < kLookupKeys; ++i)
+    (i % 2 ? odd : even).push_back({static_cast<int>(i), 0L});
+  auto res = s21_bench::Measure(kLookupKeys / 2, [&] {
+    s21::map<int, long> into(even.begin(), even.end());
+    s21::map<int, long> from(odd.begin(), odd.end());
+    for (auto it = from.begin(); it != s21::map<int, long>::iterator(); ++it)
+      into.insert(*it);
+    from.clear();
+    s21_bench::DoNotOptimize(into);
+  });
+  s21_bench::Report("s21::map merge, copy + insert (old)", res);
+  res = s21_bench::Measure(kLookupKeys / 2, [&] {
+    s21::map<int, long> into(even.begin(), even.end());
+    s21::map<int, long> from(odd.begin(), odd.end());
+    into.merge(from);
+    s21_bench::DoNotOptimize(into);
+  });
+  s21_bench::Report("s21::map merge, relink (incl. load)", res);
+  SplitJoin<s21::map<int, long>>("s21::map split + join", even);
+  SplitJoin<s21::map<int, long, s21::order_stats::on>>(
+      "s21::map split + join, order_stats::on", even);
+}
+// A time series of kLookupKeys samples whose timestamps mostly arrive in
+// order, with one in eight a few ticks late.
+void Append() {
+  std::vector<int> stamps(kLookupKeys);
+  std::mt19937 gen(8);
+  for (size_t i = 0; i < kLookupKeys; ++i)
+    stamps[i] = static_cast<int>(4 * i) - (gen() % 8 ? 0 : 1 + gen() % 8);
+  auto res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map;
+    for (int stamp : stamps) map.insert(stamp, 0L);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map append, insert", res);
+  res = s21_bench::Measure(kLookupKeys, [&] {
+    s21::map<int, long> map;
+    s21::map<int, long>::iterator last;
+    for (int stamp : stamps) last = map.emplace_hint(last, stamp, 0L);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("s21::map append, emplace_hint", res);
+  res = s21_bench::Measure(kLookupKeys, [&] {
+    std::map<int, long> map;
+    auto last = map.end();
+    for (int stamp : stamps) last = map.emplace_hint(last, stamp, 0L);
+    s21_bench::DoNotOptimize(map);
+  });
+  s21_bench::Report("std::map append, emplace_hint", res);
+}
+}  // namespace
+
+int main() {
+  std::vector<int> keys(kKeys);
+  for (size_t i = 0; i < kKeys; ++i) keys[i] = static_cast<int>(i);
+  std::shuffle(keys.begin(), keys.end(), std::mt19937(6));
+  InsertErase<s21::set<int>>("s21::set insert + erase", keys);
+  InsertErase<s21::set<int, s21::order_stats::on>>(
+      "s21::set insert + erase, order_stats::on", keys);
+  InsertErase<std::set<int>>("std::set insert + erase", keys);
+  MapInsert(keys);
+  std::vector<int> many(kLookupKeys);
+  for (size_t i = 0; i < kLookupKeys; ++i) many[i] = static_cast<int>(i);
+  std::shuffle(many.begin(), many.end(), std::mt19937(7));
+  Lookup(many);
+  MapIndex(many);
+  Percentiles(many);
+  BulkLoad();
+  Reshard();
+  Append();
+  return 0;
+}
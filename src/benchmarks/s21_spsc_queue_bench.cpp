@@ -0,0 +1,92 @@
+#include "../s21_spsc_queue/s21_spsc_queue.h"
+
+#include <thread>
+
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kRoundTrips = 200000;
+constexpr size_t kMessages = 5000000;
+constexpr size_t kBatch = 32;
+
+// One message bounces between two threads; reports the round-trip time.
+// Waiting sides yield, so the numbers stay meaningful on machines with fewer
+// cores than threads.
+template <typename Queue>
+void PingPong(const char *name) {
+  Queue ping(1024), pong(1024);
+  auto res = s21_bench::Measure(kRoundTrips, [&] {
+    std::thread echo([&] {
+      int value;
+      for (size_t i = 0; i < kRoundTrips; ++i) {
+        while (!ping.try_pop(value)) std::this_thread::yield();
+        while (!pong.try_push(value)) std::this_thread::yield();
+      }
+    });
+    int value;
+    for (size_t i = 0; i < kRoundTrips; ++i) {
+      while (!ping.try_push(static_cast<int>(i))) std::this_thread::yield();
+      while (!pong.try_pop(value)) std::this_thread::yield();
+    }
+    echo.join();
+  });
+  s21_bench::Report(name, res);
+}
+
+template <typename Queue>
+void Throughput(const char *name) {
+  Queue q(1024);
+  auto res = s21_bench::Measure(kMessages, [&] {
+    std::thread consumer([&] {
+      int value;
+      long sum = 0;
+      for (size_t i = 0; i < kMessages; ++i) {
+        while (!q.try_pop(value)) std::this_thread::yield();
+        sum += value;
+      }
+      s21_bench::DoNotOptimize(sum);
+    });
+    for (size_t i = 0; i < kMessages; ++i)
+      while (!q.try_push(static_cast<int>(i))) std::this_thread::yield();
+    consumer.join();
+  });
+  s21_bench::Report(name, res);
+}
+
+void BatchThroughput(const char *name) {
+  s21::spsc_queue<int> q(1024);
+  auto res = s21_bench::Measure(kMessages, [&] {
+    std::thread consumer([&] {
+      int buf[kBatch];
+      long sum = 0;
+      for (size_t got = 0; got < kMessages;) {
+        size_t n = q.try_pop_n(buf, kBatch);
+        if (n == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) sum += buf[i];
+        got += n;
+      }
+      s21_bench::DoNotOptimize(sum);
+    });
+    int buf[kBatch];
+    for (size_t sent = 0; sent < kMessages;) {
+      size_t n = kMessages - sent < kBatch ? kMessages - sent : kBatch;
+      for (size_t i = 0; i < n; ++i) buf[i] = static_cast<int>(sent + i);
+      size_t pushed = q.try_push_n(buf, n);
+      if (pushed == 0) std::this_thread::yield();
+      sent += pushed;
+    }
+    consumer.join();
+  });
+  s21_bench::Report(name, res);
+}
+}  // namespace
+
+int main() {
+  PingPong<s21_bench::LockedQueue<int>>(
+      "mutex + s21::queue ping-pong (round trip)");
+  PingPong<s21::spsc_queue<int>>("spsc_queue ping-pong (round trip)");
+  Throughput<s21_bench::LockedQueue<int>>("mutex + s21::queue throughput");
+  Throughput<s21::spsc_queue<int>>("spsc_queue throughput");
+  BatchThroughput("spsc_queue batched throughput");
+  return 0;
+}
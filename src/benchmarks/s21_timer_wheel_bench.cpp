@@ -0,0 +1,75 @@
+#include "../s21_timer_wheel/s21_timer_wheel.h"
+
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../s21_set/s21_set.h"
+#include "s21_bench.h"
+
+namespace {
+constexpr size_t kConnections = 1 << 18;
+constexpr size_t kEvents = 1 << 21;
+constexpr uint64_t kTimeout = 30000;
+
+// Every event is activity on a random connection, which pushes its idle
+// timeout back; the clock moves one tick per 16 events and expired
+// connections are rearmed. The ordered set keys on (deadline, id), since
+// many connections share a deadline.
+void SortedSet(const std::vector<uint32_t> &activity) {
+  using Deadline = std::pair<uint64_t, uint32_t>;
+  auto res = s21_bench::Measure(kEvents, [&] {
+    s21::set<Deadline> timeouts;
+    std::vector<s21::set<Deadline>::iterator> where;
+    for (uint32_t id = 0; id < kConnections; ++id)
+      where.push_back(timeouts.insert({kTimeout, id}).first);
+    uint64_t now = 0;
+    size_t expired = 0;
+    for (size_t i = 0; i < kEvents; ++i) {
+      uint32_t id = activity[i];
+      timeouts.erase(where[id]);
+      where[id] = timeouts.insert({now + kTimeout, id}).first;
+      if (i % 16 == 15) {
+        ++now;
+        while (timeouts.begin()->first <= now) {
+          uint32_t late = timeouts.begin()->second;
+          timeouts.erase(timeouts.begin());
+          where[late] = timeouts.insert({now + kTimeout, late}).first;
+          ++expired;
+        }
+      }
+    }
+    s21_bench::DoNotOptimize(expired);
+  });
+  s21_bench::Report("s21::set<(time, id)>", res);
+}
+
+void Wheel(const std::vector<uint32_t> &activity) {
+  auto res = s21_bench::Measure(kEvents, [&] {
+    s21::timer_wheel wheel;
+    std::vector<s21::timer> timers(kConnections);
+    for (s21::timer &t : timers) wheel.schedule(t, kTimeout);
+    size_t expired = 0;
+    for (size_t i = 0; i < kEvents; ++i) {
+      wheel.schedule_after(timers[activity[i]], kTimeout);
+      if (i % 16 == 15) {
+        expired += wheel.advance(wheel.now() + 1, [&](s21::timer &t) {
+          wheel.schedule_after(t, kTimeout);
+        });
+      }
+    }
+    s21_bench::DoNotOptimize(expired);
+  });
+  s21_bench::Report("timer_wheel", res);
+}
+}  // namespace
+
+int main() {
+  std::mt19937 gen(9);
+  std::vector<uint32_t> activity(kEvents);
+  for (uint32_t &id : activity) id = gen() % kConnections;
+  SortedSet(activity);
+  Wheel(activity);
+  return 0;
+}
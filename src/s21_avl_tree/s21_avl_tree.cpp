@@ -2,434 +2,817 @@
 
 using namespace s21;
 
-template <typename K, typename V>
-Tree<K, V>::Tree()
-    : root_(nullptr), parent_(nullptr), left_(nullptr), right_(nullptr) {}
+template <typename K, typename V, order_stats S>
+Tree<K, V, S>::Tree(const value_type &elem) : Tree() {
+  insert(elem);
+}
+
+template <typename K, typename V, order_stats S>
+Tree<K, V, S>::Tree(const std::initializer_list<value_type> &items)
+    : Tree(items.begin(), items.end()) {}
+
+template <typename K, typename V, order_stats S>
+template <typename InputIt>
+Tree<K, V, S>::Tree(InputIt first, InputIt last) : Tree() {
+  try {
+    Fill_(first, last,
+          typename std::iterator_traits<InputIt>::iterator_category());
+  } catch (...) {
+    clear();
+    throw;
+  }
+}
 
-template <typename K, typename V>
-Tree<K, V>::Tree(const value_type &elem)
-    : parent_(nullptr), left_(nullptr), right_(nullptr) {
-  root_ = new Node_(elem);
+template <typename K, typename V, order_stats S>
+Tree<K, V, S>::Tree(const Tree &other)
+    : root_(other.root_ ? Clone_(other.root_, nullptr) : nullptr),
+      leftmost_(nullptr),
+      rightmost_(nullptr),
+      size_(other.size_) {
+  FindEnds_();
+}
+
+template <typename K, typename V, order_stats S>
+Tree<K, V, S>::Tree(Tree &&other) noexcept
+    : root_(other.root_),
+      leftmost_(other.leftmost_),
+      rightmost_(other.rightmost_),
+      size_(other.size_) {
+  other.root_ = nullptr;
+  other.leftmost_ = nullptr;
+  other.rightmost_ = nullptr;
+  other.size_ = 0;
 }
 
-template <typename K, typename V>
-Tree<K, V>::~Tree() {
+template <typename K, typename V, order_stats S>
+Tree<K, V, S>::~Tree() {
   clear();
 }
 
-template <typename K, typename V>
-Tree<K, V> &Tree<K, V>::operator=(Tree &&other) {
+template <typename K, typename V, order_stats S>
+Tree<K, V, S> &Tree<K, V, S>::operator=(const Tree &other) {
   if (this != &other) {
-    parent_ = other.parent_;
-    right_ = other.right_;
-    left_ = other.left_;
-    root_ = other.root_;
-    other.parent_ = nullptr;
-    other.right_ = nullptr;
-    other.left_ = nullptr;
-    other.root_ = nullptr;
+    Tree tmp(other);
+    swap(tmp);
   }
   return *this;
 }
 
-template <typename K, typename V>
-typename Tree<K, V>::size_type Tree<K, V>::size() const {
-  int size = 0;
-  Size_(size);
-  return size;
+template <typename K, typename V, order_stats S>
+Tree<K, V, S> &Tree<K, V, S>::operator=(Tree &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
 }
 
-template <typename K, typename V>
-inline unsigned char Tree<K, V>::Height_(Tree *tr) {
-  return (tr ? tr->root_ ? tr->root_->height_ : 0 : 0);
+template <typename K, typename V, order_stats S>
+template <typename InputIt>
+void Tree<K, V, S>::assign(InputIt first, InputIt last) {
+  Tree tmp(first, last);
+  swap(tmp);
 }
 
-template <typename K, typename V>
-inline int Tree<K, V>::BalanceFactor_() {
-  return (Height_(right_) - Height_(left_));
+template <typename K, typename V, order_stats S>
+bool Tree<K, V, S>::empty() const {
+  return !root_;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::FixHeight_() {
-  root_->height_ =
-      (Height_(left_) > Height_(right_) ? Height_(left_) : Height_(right_)) + 1;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::size() const {
+  return size_;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::RotateLeft_() {
-  Tree *tmp_right = right_;
-  Tree *tmp_parent = parent_;
-  right_ = tmp_right->left_;
-  ChangePointers_(tmp_right, true);
-  FixHeight_();
-  tmp_right->FixHeight_();
-  *this = std::move(*tmp_right);
-  parent_ = tmp_parent;
-  left_->parent_ = this;
-  if (right_) right_->parent_ = this;
-  if (left_) {
-    if (left_->right_) {
-      if (!left_->right_->parent_->root_)
-        left_->right_->parent_->root_ =
-            new Node_(left_->right_->root_->element_);
-      left_->right_->parent_ = left_;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(Node_) / 2;
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::clear() {
+  Destroy_(root_);
+  root_ = nullptr;
+  leftmost_ = nullptr;
+  rightmost_ = nullptr;
+  size_ = 0;
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::merge(Tree &other) {
+  if (this == &other || !other.root_) return;
+  size_type n = size();
+  size_type m = other.size();
+  Node_ *theirs = nullptr;
+  Node_ **tail = &theirs;
+  Flatten_(other.root_, tail);
+  *tail = nullptr;
+  other.root_ = nullptr;
+  other.size_ = 0;
+  Node_ *rest = nullptr;
+  Node_ **rest_tail = &rest;
+  size_type rest_n = 0;
+  if (m * Height_(root_) < n + m) {
+    while (theirs) {
+      Node_ *node = theirs;
+      theirs = node->right_;
+      Node_ **link;
+      Node_ *parent;
+      if (Locate_(KeyOf_(node), link, parent)) {
+        *rest_tail = node;
+        rest_tail = &node->right_;
+        ++rest_n;
+      } else {
+        Link_(node, link, parent);
+      }
     }
-    if (left_->left_) {
-      if (!left_->left_->parent_->root_)
-        left_->left_->parent_->root_ = new Node_(left_->left_->root_->element_);
-      left_->left_->parent_ = left_;
+  } else {
+    Node_ *ours = nullptr;
+    tail = &ours;
+    Flatten_(root_, tail);
+    *tail = nullptr;
+    Node_ *all = nullptr;
+    tail = &all;
+    size_type all_n = 0;
+    while (ours || theirs) {
+      Node_ *node;
+      if (!theirs || (ours && KeyLess_(KeyOf_(ours), KeyOf_(theirs)))) {
+        node = ours;
+        ours = ours->right_;
+      } else if (!ours || KeyLess_(KeyOf_(theirs), KeyOf_(ours))) {
+        node = theirs;
+        theirs = theirs->right_;
+      } else {
+        node = ours;
+        ours = ours->right_;
+        *rest_tail = theirs;
+        rest_tail = &theirs->right_;
+        theirs = theirs->right_;
+        ++rest_n;
+      }
+      *tail = node;
+      tail = &node->right_;
+      ++all_n;
     }
+    root_ = Relink_(all, all_n, nullptr);
+    size_ = all_n;
+    FindEnds_();
   }
-  delete tmp_right;
-  tmp_right = nullptr;
-}
-
-template <typename K, typename V>
-void Tree<K, V>::RotateRight_() {
-  Tree *tmp_left = left_;
-  Tree *tmp_parent = parent_;
-  left_ = tmp_left->right_;
-  ChangePointers_(tmp_left, false);
-  FixHeight_();
-  tmp_left->FixHeight_();
-  *this = std::move(*tmp_left);
-  parent_ = tmp_parent;
-  right_->parent_ = this;
-
-  if (left_) left_->parent_ = this;
-
-  if (right_) {
-    if (right_->left_) {
-      if (!right_->left_->parent_->root_)
-        right_->left_->parent_->root_ =
-            new Node_(right_->left_->root_->element_);
-      right_->left_->parent_ = right_;
-    }
-    if (right_->right_) {
-      if (!right_->right_->parent_->root_)
-        right_->right_->parent_->root_ =
-            new Node_(right_->right_->root_->element_);
-      right_->right_->parent_ = right_;
-    }
+  other.root_ = Relink_(rest, rest_n, nullptr);
+  other.size_ = rest_n;
+  other.FindEnds_();
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::join(Tree &other) {
+  if (this == &other || !other.root_) return;
+  if (!root_) {
+    swap(other);
+    return;
   }
+  Node_ *mid = other.leftmost_;
+  if (!KeyLess_(KeyOf_(rightmost_), KeyOf_(mid)))
+    throw std::logic_error("Trees overlap");
+  size_type moved = other.size_;
+  Node_ *last = other.rightmost_;
+  other.Unlink_(mid);
+  Join_(mid, other);
+  rightmost_ = last;
+  size_ += moved;
+  other.clear();
+}
 
-  delete tmp_left;
-  tmp_left = nullptr;
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::swap(Tree &other) {
+  std::swap(root_, other.root_);
+  std::swap(leftmost_, other.leftmost_);
+  std::swap(rightmost_, other.rightmost_);
+  std::swap(size_, other.size_);
+}
+
+template <typename K, typename V, order_stats S>
+bool Tree<K, V, S>::contains(const K &key) const {
+  return FindNode_(key) != nullptr;
+}
+
+template <typename K, typename V, order_stats S>
+std::pair<typename Tree<K, V, S>::iterator, bool> Tree<K, V, S>::insert(
+    const value_type &value) {
+  std::pair<Node_ *, bool> res = Insert_(Traits_::KeyOf(value), value);
+  return {MakeIterator_(res.first), res.second};
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::erase(iterator pos) {
+  if (!pos.node_) return;
+  Unlink_(pos.node_);
+  delete pos.node_;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::erase(const K &key) {
+  Node_ *node = FindNode_(key);
+  if (!node) return 0;
+  Unlink_(node);
+  delete node;
+  return 1;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::node_type Tree<K, V, S>::extract(iterator pos) {
+  if (pos.node_) Unlink_(pos.node_);
+  return node_type(pos.node_);
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::node_type Tree<K, V, S>::extract(const K &key) {
+  Node_ *node = FindNode_(key);
+  if (node) Unlink_(node);
+  return node_type(node);
+}
+
+template <typename K, typename V, order_stats S>
+std::pair<typename Tree<K, V, S>::iterator, bool> Tree<K, V, S>::insert(
+    node_type &&node) {
+  if (!node.node_) return {iterator(), false};
+  Node_ **link;
+  Node_ *parent;
+  Node_ *found = Locate_(KeyOf_(node.node_), link, parent);
+  if (found) return {MakeIterator_(found), false};
+  Link_(node.node_, link, parent);
+  std::swap(found, node.node_);
+  return {MakeIterator_(found), true};
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::insert(
+    const_iterator hint, const value_type &value) {
+  Node_ **link;
+  Node_ *parent;
+  Node_ *found =
+      LocateNear_(hint.node_, Traits_::KeyOf(value), link, parent);
+  if (found) return MakeIterator_(found);
+  Node_ *node = new Node_(parent, value);
+  Link_(node, link, parent);
+  return MakeIterator_(node);
+}
+
+// The element is built first, as its key is only known then.
+template <typename K, typename V, order_stats S>
+template <typename... Args>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::emplace_hint(
+    const_iterator hint, Args &&...args) {
+  Node_ *node = new Node_(nullptr, std::forward<Args>(args)...);
+  Node_ **link;
+  Node_ *parent;
+  Node_ *found = LocateNear_(hint.node_, KeyOf_(node), link, parent);
+  if (found) {
+    delete node;
+    return MakeIterator_(found);
+  }
+  Link_(node, link, parent);
+  return MakeIterator_(node);
 }
 
-template <typename K, typename V>
-void Tree<K, V>::ChangePointers_(Tree *tmp, bool is_left) {
-  auto *tmp_this = new Tree<K, V>();
-  tmp_this->parent_ = parent_;
-  tmp_this->left_ = left_;
-  tmp_this->right_ = right_;
-  tmp_this->root_ = root_;
-  if (is_left)
-    tmp->left_ = tmp_this;
-  else
-    tmp->right_ = tmp_this;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::find(const K &key) const {
+  Node_ *node = FindNode_(key);
+  if (!node) throw std::out_of_range("Key does not exist");
+  return MakeIterator_(node);
 }
 
-template <typename K, typename V>
-void Tree<K, V>::Balance_() {
-  FixHeight_();
-  int balance = BalanceFactor_();
-  if (balance == 2) {
-    if (right_->BalanceFactor_() < 0) {
-      right_->RotateRight_();
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::count(const K &key) const {
+  return FindNode_(key) ? 1 : 0;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::lower_bound(
+    const K &key) const {
+  return MakeIterator_(LowerBound_(key));
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::upper_bound(
+    const K &key) const {
+  return MakeIterator_(UpperBound_(key));
+}
+
+template <typename K, typename V, order_stats S>
+std::pair<typename Tree<K, V, S>::iterator, typename Tree<K, V, S>::iterator>
+Tree<K, V, S>::equal_range(const K &key) const {
+  Node_ *lower = LowerBound_(key);
+  Node_ *upper = lower && !(key < KeyOf_(lower)) ? Next_(lower) : lower;
+  return {MakeIterator_(lower), MakeIterator_(upper)};
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::iterator Tree<K, V, S>::nth_element(
+    size_type k) const {
+  static_assert(kCounted_, "nth_element needs order_stats::on");
+  if (k >= size()) throw std::out_of_range("Index out of range");
+  Node_ *node = root_;
+  while (k != CountOf_(node->left_)) {
+    if (k < CountOf_(node->left_)) {
+      node = node->left_;
+    } else {
+      k -= CountOf_(node->left_) + 1;
+      node = node->right_;
     }
-    RotateLeft_();
-  } else if (balance == -2) {
-    if (left_->BalanceFactor_() > 0) left_->RotateLeft_();
-    RotateRight_();
   }
+  return MakeIterator_(node);
 }
 
-template <typename K, typename V>
-void Tree<K, V>::Insert_(const value_type &elem, Iterator &iter,
-                         bool &is_inserted) {
-  if (!root_) {
-    root_ = new Node_(elem);
-    iter.SetTree(this);
-    is_inserted = true;
-    return;
-  }
-  if (elem.first < root_->element_.first) {
-    if (!left_) {
-      left_ = new Tree;
-      left_->parent_ = this;
-    }
-    left_->Insert_(elem, iter, is_inserted);
-  } else if (elem.first > root_->element_.first) {
-    if (!right_) {
-      right_ = new Tree;
-      right_->parent_ = this;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::rank(const K &key) const {
+  static_assert(kCounted_, "rank needs order_stats::on");
+  size_type less = 0;
+  for (Node_ *node = root_; node;) {
+    if (KeyOf_(node) < key) {
+      less += CountOf_(node->left_) + 1;
+      node = node->right_;
+    } else {
+      node = node->left_;
     }
-    right_->Insert_(elem, iter, is_inserted);
   }
-  Balance_();
+  return less;
 }
 
-template <typename K, typename V>
-Tree<K, V> *Tree<K, V>::FindMin(const Tree *node) const {
-  return (node->left_ && node->left_->root_ ? FindMin(node->left_)
-                                            : (Tree<K, V> *)node);
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::count_range(
+    const K &low, const K &high) const {
+  return low < high ? rank(high) - rank(low) : 0;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::erase(Tree<K, V>::Iterator pos) {
-  Tree<K, V> *current = GetTree_(pos);
-  if (current == this) {
-    RemoveThis_(current);
-  } else {
-    auto parent = current->parent_;
-    if (!current->left_ && !current->right_) {
-      RemoveEdge_(current, parent);
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::FindNode_(const K &key) const {
+  Node_ *node = root_;
+  while (node) {
+    if (key < KeyOf_(node))
+      node = node->left_;
+    else if (KeyOf_(node) < key)
+      node = node->right_;
+    else
+      break;
+  }
+  return node;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::LowerBound_(
+    const K &key) const {
+  Node_ *node = root_;
+  Node_ *found = nullptr;
+  while (node) {
+    if (KeyOf_(node) < key) {
+      node = node->right_;
     } else {
-      RemoveNode_(current, parent);
+      found = node;
+      node = node->left_;
     }
   }
-  if (root_) Balance_();
-}
-
-template <typename K, typename V>
-void Tree<K, V>::Size_(int &size) const {
-  if (root_) ++size;
-  if (right_) right_->Size_(size);
-  if (left_) left_->Size_(size);
-}
-
-template <typename K, typename V>
-Tree<K, V> *Tree<K, V>::FindMax(const Tree *node) const {
-  return (node->right_ && node->right_->root_ ? FindMax(node->right_)
-                                              : (Tree<K, V> *)node);
-}
-
-template <typename K, typename V>
-void Tree<K, V>::clear() {
-  delete left_;
-  delete right_;
-  delete root_;
-}
-
-template <typename K, typename V>
-void Tree<K, V>::Swap_(Tree<K, V> &other) {
-  Node_ *tmp_root = root_;
-  Tree<K, V> *tmp_left = left_;
-  Tree<K, V> *tmp_right = right_;
-  Tree<K, V> *tmp_parent = parent_;
-  root_ = other.root_;
-  left_ = other.left_;
-  right_ = other.right_;
-  parent_ = other.parent_;
-  other.root_ = tmp_root;
-  other.left_ = tmp_left;
-  other.right_ = tmp_right;
-  other.parent_ = tmp_parent;
-}
-
-template <typename K, typename V>
-void Tree<K, V>::RemoveThis_(Tree<K, V> *current) {
-  if (current->right_ || current->left_) {
-    Tree<K, V> *min =
-        FindMin(current->right_ ? current->right_ : current->left_);
-    Tree<K, V> *min_parent = min->parent_;
-    if (min_parent->left_ == min)
-      min_parent->left_ = nullptr;
-    else
-      min_parent->right_ = nullptr;
-    min->parent_ = nullptr;
-    if (left_) {
-      min->left_ = left_;
-      left_ = nullptr;
-    }
-    if (right_) {
-      min->right_ = right_;
-      right_ = nullptr;
+  return found;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::UpperBound_(
+    const K &key) const {
+  Node_ *node = root_;
+  Node_ *found = nullptr;
+  while (node) {
+    if (key < KeyOf_(node)) {
+      found = node;
+      node = node->left_;
+    } else {
+      node = node->right_;
     }
-    Swap_(*min);
-    if (right_) right_->parent_ = this;
-    delete min;
+  }
+  return found;
+}
+
+template <typename K, typename V, order_stats S>
+template <typename... Args>
+std::pair<typename Tree<K, V, S>::Node_ *, bool> Tree<K, V, S>::Insert_(
+    const K &key, Args &&...args) {
+  Node_ **link;
+  Node_ *parent;
+  Node_ *found = Locate_(key, link, parent);
+  if (found) return {found, false};
+  Node_ *node = new Node_(parent, std::forward<Args>(args)...);
+  Link_(node, link, parent);
+  return {node, true};
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::SplitOff_(const K &key, Tree &right) {
+  right.clear();
+  Node_ *node = root_;
+  size_type total = size_;
+  root_ = nullptr;
+  Split_(node, key, *this, right);
+  if (kCounted_) {
+    size_ = CountOf_(root_);
   } else {
-    delete root_;
-    root_ = nullptr;
+    // Walks both halves in step until the smaller one runs out.
+    Node_ *left = root_ ? Min_(root_) : nullptr;
+    Node_ *high = right.root_ ? Min_(right.root_) : nullptr;
+    size_type steps = 0;
+    for (; left && high; ++steps) {
+      left = Next_(left);
+      high = Next_(high);
+    }
+    size_ = left ? total - steps : steps;
   }
+  right.size_ = total - size_;
+  FindEnds_();
+  right.FindEnds_();
 }
 
-template <typename K, typename V>
-void Tree<K, V>::RemoveEdge_(Tree<K, V> *current, Tree<K, V> *parent) {
-  if (parent->left_ == current) {
-    delete current;
-    parent->left_ = nullptr;
-  } else if (parent->right_ == current) {
-    delete current;
-    parent->right_ = nullptr;
-  }
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::FindEnds_() {
+  leftmost_ = root_ ? Min_(root_) : nullptr;
+  rightmost_ = root_ ? Max_(root_) : nullptr;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::RemoveNode_(Tree<K, V> *current, Tree<K, V> *parent) {
-  Tree<K, V> *min = FindMin(current->right_ ? current->right_ : current->left_);
-  Tree<K, V> *min_parent = min->parent_;
-  if (min_parent->right_ == min)
-    min_parent->right_ = nullptr;
-  else
-    min_parent->left_ = nullptr;
-  if (parent->right_ == current)
-    parent->right_ = min;
-  else
-    parent->left_ = min;
-  min->left_ = current->left_;
-  min->right_ = current->right_;
-  min->parent_ = parent;
-  if (min->left_) min->left_->parent_ = min;
-  if (min->right_) min->right_->parent_ = min;
-  current->left_ = nullptr;
-  current->right_ = nullptr;
-  current->parent_ = nullptr;
-  delete current;
-}
-
-template <typename K, typename V>
-bool Tree<K, V>::empty() const {
-  return !root_;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::size_type Tree<K, V, S>::SizeOf_(const Node_ *node) {
+  if (kCounted_) return CountOf_(node);
+  size_type n = 0;
+  for (; node; node = node->right_) n += SizeOf_(node->left_) + 1;
+  return n;
 }
 
-template <typename K, typename V>
-typename Tree<K, V>::size_type Tree<K, V>::max_size() const {
-  return std::numeric_limits<size_type>::max() / sizeof(Tree<V, V>) / 2;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Min_(Node_ *node) {
+  while (node->left_) node = node->left_;
+  return node;
 }
 
-template <typename K, typename V>
-Tree<K, V>::Tree(const std::initializer_list<value_type> &items)
-    : root_(nullptr), parent_(nullptr), left_(nullptr), right_(nullptr) {
-  for (value_type i : items) insert(i);
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Max_(Node_ *node) {
+  while (node->right_) node = node->right_;
+  return node;
 }
 
-template <typename K, typename V>
-Tree<K, V> &Tree<K, V>::operator=(const Tree &other) {
-  if (this != &other) {
-    auto it = other.begin();
-    clear();
-    root_ = nullptr;
-    parent_ = nullptr;
-    left_ = nullptr;
-    right_ = nullptr;
-    std::pair<K, V> el;
-    el.first = it->first;
-    el.second = it->second;
-    insert(el);
-    while (true) {
-      if (it == other.end()) break;
-      ++it;
-      el.first = it->first;
-      el.second = it->second;
-      insert(el);
-    }
-  }
-  return *this;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Next_(Node_ *node) {
+  if (node->right_) return Min_(node->right_);
+  while (node->parent_ && node == node->parent_->right_) node = node->parent_;
+  return node->parent_;
 }
 
-template <typename K, typename V>
-Tree<K, V>::Tree(const Tree &other)
-    : root_(nullptr), parent_(nullptr), left_(nullptr), right_(nullptr) {
-  *this = other;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Prev_(Node_ *node) {
+  if (node->left_) return Max_(node->left_);
+  while (node->parent_ && node == node->parent_->left_) node = node->parent_;
+  return node->parent_;
 }
 
-template <typename K, typename V>
-Tree<K, V>::Tree(Tree &&other) {
-  *this = std::move(other);
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Update_(Node_ *node) {
+  int left = Height_(node->left_);
+  int right = Height_(node->right_);
+  node->height_ = (left > right ? left : right) + 1;
+  if (kCounted_)
+    node->count_ = CountOf_(node->left_) + CountOf_(node->right_) + 1;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::merge(Tree<K, V> &other) {
-  if (!other.root_) return;
-  auto itr1 = other.begin();
-  std::pair<K, V> sorry;
-  for (; itr1 != other.end(); itr1++) {
-    sorry.first = itr1->first;
-    sorry.second = itr1->second;
-    insert(sorry);
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Destroy_(Node_ *node) {
+  while (node) {
+    Destroy_(node->right_);
+    Node_ *left = node->left_;
+    delete node;
+    node = left;
   }
-  sorry.first = itr1->first;
-  sorry.second = itr1->second;
-  insert(sorry);
-  other.clear();
-  other.root_ = nullptr;
-  other.right_ = nullptr;
-  other.left_ = nullptr;
-  other.parent_ = nullptr;
 }
 
-template <typename K, typename V>
-void Tree<K, V>::swap(Tree &other) {
-  Swap_(other);
-}
-
-template <typename K, typename V>
-std::pair<typename Tree<K, V>::iterator, bool> Tree<K, V>::insert(
-    const Tree::value_type &value) {
-  iterator it;
-  bool is_inserted = false;
-  Insert_(value, it, is_inserted);
-  std::pair<iterator, bool> res = {it, is_inserted};
-  return res;
+// Both builders free what they made so far if an element's constructor
+// throws.
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Clone_(const Node_ *node,
+                                                     Node_ *parent) {
+  Node_ *copy = new Node_(parent, node->value_);
+  try {
+    if (node->left_) copy->left_ = Clone_(node->left_, copy);
+    if (node->right_) copy->right_ = Clone_(node->right_, copy);
+  } catch (...) {
+    Destroy_(copy);
+    throw;
+  }
+  copy->height_ = node->height_;
+  copy->count_ = node->count_;
+  return copy;
+}
+
+template <typename K, typename V, order_stats S>
+template <typename ForwardIt>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Build_(ForwardIt &it,
+                                                     size_type n,
+                                                     Node_ *parent) {
+  if (n == 0) return nullptr;
+  Node_ *left = Build_(it, n / 2, nullptr);
+  Node_ *node;
+  try {
+    node = new Node_(parent, *it);
+  } catch (...) {
+    Destroy_(left);
+    throw;
+  }
+  ++it;
+  node->left_ = left;
+  if (left) left->parent_ = node;
+  try {
+    node->right_ = Build_(it, n - n / 2 - 1, node);
+  } catch (...) {
+    Destroy_(node);
+    throw;
+  }
+  Update_(node);
+  return node;
+}
+
+template <typename K, typename V, order_stats S>
+template <typename InputIt>
+void Tree<K, V, S>::Fill_(InputIt first, InputIt last,
+                          std::input_iterator_tag) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename K, typename V, order_stats S>
+template <typename ForwardIt>
+void Tree<K, V, S>::Fill_(ForwardIt first, ForwardIt last,
+                          std::forward_iterator_tag) {
+  size_type n = 0;
+  bool sorted = true;
+  for (ForwardIt prev = first, it = first; it != last; prev = it++, ++n) {
+    if (it != first &&
+        !KeyLess_(Traits_::KeyOf(*prev), Traits_::KeyOf(*it))) {
+      sorted = false;
+      break;
+    }
+  }
+  if (!sorted) {
+    Fill_(first, last, std::input_iterator_tag());
+    return;
+  }
+  root_ = Build_(first, n, nullptr);
+  size_ = n;
+  FindEnds_();
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Flatten_(Node_ *node, Node_ **&tail) {
+  while (node) {
+    Flatten_(node->left_, tail);
+    Node_ *right = node->right_;
+    *tail = node;
+    tail = &node->right_;
+    node = right;
+  }
 }
 
-template <typename K, typename V>
-bool Tree<K, V>::contains(const K &key) const {
-  bool contains = true;
-  Contains_(key, contains);
-  return contains;
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Relink_(Node_ *&list,
+                                                      size_type n,
+                                                      Node_ *parent) {
+  if (n == 0) return nullptr;
+  Node_ *left = Relink_(list, n / 2, nullptr);
+  Node_ *node = list;
+  list = node->right_;
+  node->parent_ = parent;
+  node->left_ = left;
+  if (left) left->parent_ = node;
+  node->right_ = Relink_(list, n - n / 2 - 1, node);
+  Update_(node);
+  return node;
+}
+
+// Splits node's subtree at its root: the side that key does not fall in
+// is joined, with the root, to the matching half of the recursive split.
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Split_(Node_ *node, const K &key, Tree &left,
+                           Tree &right) {
+  if (!node) return;
+  Tree side;
+  if (KeyOf_(node) < key) {
+    side.root_ = node->left_;
+    Node_ *rest = node->right_;
+    if (rest) rest->parent_ = nullptr;
+    if (side.root_) side.root_->parent_ = nullptr;
+    Split_(rest, key, left, right);
+    side.Join_(node, left);
+    left.swap(side);
+  } else {
+    side.root_ = node->right_;
+    Node_ *rest = node->left_;
+    if (rest) rest->parent_ = nullptr;
+    if (side.root_) side.root_->parent_ = nullptr;
+    Split_(rest, key, left, right);
+    right.Join_(node, side);
+  }
 }
 
-template <typename K, typename V>
-void Tree<K, V>::Contains_(const K &key, bool &contains) const {
-  if (!root_ || (!left_ && !right_ && root_->element_.first != key)) {
-    contains = false;
-  } else if (key < root_->element_.first) {
-    if (left_)
-      left_->Contains_(key, contains);
-    else
-      contains = false;
-  } else if (key > root_->element_.first) {
-    if (right_)
-      right_->Contains_(key, contains);
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Replace_(Node_ *node, Node_ *replacement) {
+  Node_ *parent = node->parent_;
+  if (!parent)
+    root_ = replacement;
+  else if (parent->left_ == node)
+    parent->left_ = replacement;
+  else
+    parent->right_ = replacement;
+  if (replacement) replacement->parent_ = parent;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::RotateLeft_(Node_ *node) {
+  Node_ *pivot = node->right_;
+  node->right_ = pivot->left_;
+  if (pivot->left_) pivot->left_->parent_ = node;
+  Replace_(node, pivot);
+  pivot->left_ = node;
+  node->parent_ = pivot;
+  Update_(node);
+  Update_(pivot);
+  return pivot;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::RotateRight_(Node_ *node) {
+  Node_ *pivot = node->left_;
+  node->left_ = pivot->right_;
+  if (pivot->right_) pivot->right_->parent_ = node;
+  Replace_(node, pivot);
+  pivot->right_ = node;
+  node->parent_ = pivot;
+  Update_(node);
+  Update_(pivot);
+  return pivot;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Balance_(Node_ *node) {
+  Update_(node);
+  int balance = BalanceFactor_(node);
+  if (balance == 2) {
+    if (BalanceFactor_(node->right_) < 0) RotateRight_(node->right_);
+    return RotateLeft_(node);
+  }
+  if (balance == -2) {
+    if (BalanceFactor_(node->left_) > 0) RotateLeft_(node->left_);
+    return RotateRight_(node);
+  }
+  return node;
+}
+
+// Once a subtree comes out of the fix-up as tall as it was, nothing above
+// it can be out of balance, so only the counts, if kept, are left to fix.
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::RebalanceUp_(Node_ *node) {
+  while (node) {
+    size_type height = node->height_;
+    node = Balance_(node);
+    if (node->height_ == height) break;
+    node = node->parent_;
+  }
+  if (!kCounted_) return;
+  for (node = node ? node->parent_ : nullptr; node; node = node->parent_)
+    node->count_ = CountOf_(node->left_) + CountOf_(node->right_) + 1;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::Locate_(const K &key,
+                                                      Node_ **&link,
+                                                      Node_ *&parent) {
+  parent = nullptr;
+  link = &root_;
+  while (*link) {
+    parent = *link;
+    if (key < KeyOf_(parent))
+      link = &parent->left_;
+    else if (KeyOf_(parent) < key)
+      link = &parent->right_;
     else
-      contains = false;
+      return parent;
   }
-}
-
-template <typename K, typename V>
-void Tree<K, V>::const_iterator::OperationPlus_() {
-  if (tree_->right_)
-    tree_ = tree_->FindMin(tree_->right_);
-  else if (!tree_->left_ && !tree_->right_) {
-    if (tree_->parent_) {
-      if (tree_->parent_->left_ == tree_)
-        tree_ = tree_->parent_;
-      else if (tree_->parent_->right_ == tree_)
-        if (tree_->parent_ && tree_->parent_->parent_)
-          tree_ = tree_->parent_->parent_;
+  return nullptr;
+}
+
+template <typename K, typename V, order_stats S>
+typename Tree<K, V, S>::Node_ *Tree<K, V, S>::LocateNear_(Node_ *hint,
+                                                          const K &key,
+                                                          Node_ **&link,
+                                                          Node_ *&parent) {
+  if (!hint) hint = rightmost_;
+  if (!hint) return Locate_(key, link, parent);
+  // Between two neighbours, exactly one has a free link facing the other.
+  if (KeyOf_(hint) < key) {
+    Node_ *next = hint == rightmost_ ? nullptr : Next_(hint);
+    if (!next || key < KeyOf_(next)) {
+      parent = hint->right_ ? next : hint;
+      link = hint->right_ ? &next->left_ : &hint->right_;
+      return nullptr;
+    }
+  } else if (key < KeyOf_(hint)) {
+    Node_ *prev = hint == leftmost_ ? nullptr : Prev_(hint);
+    if (!prev || KeyOf_(prev) < key) {
+      parent = hint->left_ ? prev : hint;
+      link = hint->left_ ? &prev->right_ : &hint->left_;
+      return nullptr;
     }
-  } else if (tree_->parent_) {
-    tree_ = tree_->parent_;
+  } else {
+    return hint;
   }
-}
-
-template <typename K, typename V>
-void Tree<K, V>::const_iterator::OperationMinus_() {
-  if (tree_->left_)
-    tree_ = tree_->FindMax(tree_->left_);
-  else if (!tree_->left_ && !tree_->right_) {
-    if (tree_->parent_) {
-      if (tree_->parent_->right_ == tree_)
-        tree_ = tree_->parent_;
-      else if (tree_->parent_->left_ == tree_)
-        if (tree_->parent_ && tree_->parent_->parent_)
-          tree_ = tree_->parent_->parent_;
+  return Locate_(key, link, parent);
+}
+
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Link_(Node_ *node, Node_ **link, Node_ *parent) {
+  node->left_ = nullptr;
+  node->right_ = nullptr;
+  node->parent_ = parent;
+  node->height_ = 1;
+  node->count_ = 1;
+  if (!parent) {
+    leftmost_ = rightmost_ = node;
+  } else if (link == &parent->left_) {
+    if (parent == leftmost_) leftmost_ = node;
+  } else if (parent == rightmost_) {
+    rightmost_ = node;
+  }
+  *link = node;
+  ++size_;
+  RebalanceUp_(parent);
+}
+
+// Unlinks node, putting its in-order successor in its place when it has
+// two children, and rebalances from the lowest node whose subtree changed.
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Unlink_(Node_ *node) {
+  // At either end the neighbour is a child or the parent.
+  if (node == leftmost_) leftmost_ = Next_(node);
+  if (node == rightmost_) rightmost_ = Prev_(node);
+  Node_ *changed;
+  if (!node->left_ || !node->right_) {
+    changed = node->parent_;
+    Replace_(node, node->left_ ? node->left_ : node->right_);
+  } else {
+    Node_ *next = Min_(node->right_);
+    if (next->parent_ != node) {
+      changed = next->parent_;
+      Replace_(next, next->right_);
+      next->right_ = node->right_;
+      next->right_->parent_ = next;
+    } else {
+      changed = next;
     }
-  } else if (tree_->parent_) {
-    tree_ = tree_->parent_;
+    Replace_(node, next);
+    next->left_ = node->left_;
+    next->left_->parent_ = next;
+    // RebalanceUp_ compares against the height of the place next took.
+    next->height_ = node->height_;
+  }
+  --size_;
+  RebalanceUp_(changed);
+}
+
+// The taller side takes mid and the shorter tree in along its spine, at
+// the first node no more than one level taller than the shorter tree, and
+// is rebalanced from there up: O(difference in heights).
+template <typename K, typename V, order_stats S>
+void Tree<K, V, S>::Join_(Node_ *mid, Tree &right) {
+  Node_ *left = root_;
+  root_ = nullptr;
+  Node_ *high = right.root_;
+  right.root_ = nullptr;
+  int left_height = Height_(left);
+  int right_height = Height_(high);
+  mid->parent_ = nullptr;
+  if (left_height > right_height + 1) {
+    Node_ *parent = left;
+    while (Height_(parent->right_) > right_height + 1)
+      parent = parent->right_;
+    mid->left_ = parent->right_;
+    mid->right_ = high;
+    parent->right_ = mid;
+    mid->parent_ = parent;
+    root_ = left;
+  } else if (right_height > left_height + 1) {
+    Node_ *parent = high;
+    while (Height_(parent->left_) > left_height + 1) parent = parent->left_;
+    mid->left_ = left;
+    mid->right_ = parent->left_;
+    parent->left_ = mid;
+    mid->parent_ = parent;
+    root_ = high;
+  } else {
+    mid->left_ = left;
+    mid->right_ = high;
+    root_ = mid;
   }
+  if (mid->left_) mid->left_->parent_ = mid;
+  if (mid->right_) mid->right_->parent_ = mid;
+  Update_(mid);
+  RebalanceUp_(mid->parent_);
 }
@@ -1,170 +1,356 @@
 #ifndef S21_AVL_TREE
 #define S21_AVL_TREE
 
-#include <iostream>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace s21 {
+// Whether a tree's nodes count their subtree. The counts make nth_element,
+// rank and count_range O(log n), but every insert and erase then has to
+// update all ancestors of the node it changed.
+enum class order_stats { off, on };
+
+namespace tree_detail {
+// What a tree stores per key: map trees keep a key/value pair, set trees
+// (V = void) keep the bare key.
 template <typename K, typename V>
+struct Traits {
+  using value_type = std::pair<const K, V>;
+  using reference = value_type &;
+  // Also takes other pair types, as read from a source range.
+  template <typename T>
+  static const auto &KeyOf(const T &value) {
+    return value.first;
+  }
+};
+
+template <typename K>
+struct Traits<K, void> {
+  using value_type = K;
+  using reference = const K &;  // Keys must not change under the tree.
+  template <typename T>
+  static const T &KeyOf(const T &value) {
+    return value;
+  }
+};
+
+// Set operations over trees, see s21_set_algebra.h.
+template <typename Container>
+class SetAlgebra;
+}  // namespace tree_detail
+
+// AVL tree behind s21::set and s21::map. Every element lives in a single
+// node that also holds the height and the left, right and parent links, so
+// an insert allocates once and rotations only relink pointers: iterators
+// and references stay valid until their element is erased.
+//
+// With order_stats::on, nodes also count their subtree, which lets
+// nth_element, rank and count_range answer in one descent.
+template <typename K, typename V, order_stats Stats = order_stats::off>
 class Tree {
+  using Traits_ = tree_detail::Traits<K, V>;
+  static constexpr bool kCounted_ = Stats == order_stats::on;
+  template <typename Container>
+  friend class tree_detail::SetAlgebra;
+
  public:
   using key_type = K;
   using mapped_type = V;
-  using value_type = std::pair<const key_type, mapped_type>;
+  using value_type = typename Traits_::value_type;
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
 
-  Tree();
-
-  explicit Tree(const value_type &elem);
-  Tree(std::initializer_list<value_type> const &items);
-  Tree(const Tree &other);
-  Tree(Tree &&other);
-
-  virtual ~Tree();
-
-  bool empty() const;
-  size_type size() const;
-  size_type max_size() const;
-  void clear();
-  void merge(Tree<K, V> &other);
-  void swap(Tree &other);
-  bool contains(const K &key) const;
-
-  Tree &operator=(const Tree &other);
-  Tree &operator=(Tree &&other);
-
  protected:
-  typedef struct Node_ {
-    value_type element_;
-    unsigned char height_;
-    explicit Node_(const value_type &elem) : element_(elem), height_(1){};
-  } Node_;
+  struct Node_ {
+    template <typename... Args>
+    explicit Node_(Node_ *parent, Args &&...args)
+        : left_(nullptr),
+          right_(nullptr),
+          parent_(parent),
+          height_(1),
+          count_(1),
+          value_(std::forward<Args>(args)...) {}
 
-  Node_ *root_;
-  Tree *parent_;
-  Tree *left_;
-  Tree *right_;
+    Node_ *left_;
+    Node_ *right_;
+    Node_ *parent_;
+    // Packed into one word, so a node is no bigger than a std::set node.
+    // count_ is only kept up to date with order_stats::on.
+    size_type height_ : 8;
+    size_type count_ : 56;
+    value_type value_;
+  };
 
-  class ConstIterator {
+  // Walks the nodes in key order. Stepping past the largest element gives
+  // a null position, and stepping back from it gives the largest element.
+  template <bool Const>
+  class Iterator_ {
    public:
-    ConstIterator() : tree_(nullptr) {}
-    ConstIterator(const ConstIterator &other) { tree_ = other.tree_; }
-    explicit ConstIterator(Tree<K, V> *tree) : tree_(tree) {}
-    ~ConstIterator() = default;
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = typename Tree::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, const value_type &,
+                                         typename Traits_::reference>;
+    using pointer = std::remove_reference_t<reference> *;
 
-    bool operator==(const ConstIterator &other) {
-      return this->tree_ == other.tree_;
+    Iterator_() : node_(nullptr), tree_(nullptr) {}
+    template <bool C = Const, typename = std::enable_if_t<C>>
+    Iterator_(const Iterator_<false> &other)
+        : node_(other.node_), tree_(other.tree_) {}
+
+    reference operator*() const { return node_->value_; }
+    pointer operator->() const { return &node_->value_; }
+    bool operator==(const Iterator_ &other) const {
+      return node_ == other.node_;
     }
-    bool operator!=(const ConstIterator &other) {
-      return this->tree_ != other.tree_;
+    bool operator!=(const Iterator_ &other) const {
+      return node_ != other.node_;
     }
-    const value_type *operator->() { return &(tree_->root_->element_); }
-    ConstIterator operator++() {
-      OperationPlus_();
+
+    Iterator_ &operator++() {
+      node_ = Next_(node_);
       return *this;
     }
-    ConstIterator operator++(int) {
-      ConstIterator tmp(*this);
-      OperationPlus_();
+    Iterator_ operator++(int) {
+      Iterator_ tmp(*this);
+      ++*this;
       return tmp;
     }
-    ConstIterator operator+=(size_type n) {
-      while (n-- > 0) operator++();
+    Iterator_ &operator--() {
+      node_ = node_ ? Prev_(node_) : tree_->rightmost_;
       return *this;
     }
-    ConstIterator operator--() {
-      OperationMinus_();
-      return *this;
-    }
-    ConstIterator operator--(int) {
-      ConstIterator tmp(*this);
-      OperationMinus_();
+    Iterator_ operator--(int) {
+      Iterator_ tmp(*this);
+      --*this;
       return tmp;
     }
-    ConstIterator operator-=(size_type n) {
-      while (n-- > 0) operator--();
+    Iterator_ &operator+=(size_type n) {
+      while (n-- > 0) ++*this;
       return *this;
     }
-    Tree<K, V> *GetTree() { return tree_; }
-    Node_ *GetNode() { return tree_->root_; }
-    void SetTree(Tree<K, V> *tr) { tree_ = tr; }
-
-   protected:
-    Tree<K, V> *tree_;
-    void OperationPlus_();
-    void OperationMinus_();
+    Iterator_ &operator-=(size_type n) {
+      while (n-- > 0) --*this;
+      return *this;
+    }
+
+   private:
+    friend class Tree;
+    template <bool>
+    friend class Iterator_;
+
+    Iterator_(Node_ *node, const Tree *tree) : node_(node), tree_(tree) {}
+
+    Node_ *node_;
+    const Tree *tree_;
   };
 
-  class Iterator : public ConstIterator {
+ public:
+  using iterator = Iterator_<false>;
+  using const_iterator = Iterator_<true>;
+
+  // Owns an element taken out of a tree by extract(), until it is
+  // inserted into another tree of the same type or the handle dies.
+  class node_type {
    public:
-    Iterator() : ConstIterator() {}
-    explicit Iterator(Tree<K, V> *tree) : ConstIterator(tree) {}
-    ~Iterator() = default;
+    node_type() : node_(nullptr) {}
+    node_type(node_type &&other) noexcept : node_(other.node_) {
+      other.node_ = nullptr;
+    }
+    node_type &operator=(node_type &&other) noexcept {
+      std::swap(node_, other.node_);
+      return *this;
+    }
+    ~node_type() { delete node_; }
 
-    value_type *operator->() { return &(this->tree_->root_->element_); }
-  };
+    bool empty() const { return !node_; }
+    explicit operator bool() const { return node_ != nullptr; }
+    value_type &value() const { return node_->value_; }
 
-  void Insert_(const value_type &elem, Iterator &iter, bool &is_inserted);
+   private:
+    friend class Tree;
+    explicit node_type(Node_ *node) : node_(node) {}
 
-  Tree *FindMin(const Tree *node) const;
-  Tree *FindMax(const Tree *node) const;
+    Node_ *node_;
+  };
 
- private:
-  unsigned char Height_(Tree *tr);
-  int BalanceFactor_();
-  void FixHeight_();
-  void RotateLeft_();
-  void RotateRight_();
-  void ChangePointers_(Tree *tmp, bool is_left);
-  void Balance_();
-  void Size_(int &size) const;
-  void Swap_(Tree<K, V> &other);
-  void Contains_(const K &key, bool &contains) const;
-  void RemoveThis_(Tree<K, V> *current);
-  void RemoveEdge_(Tree<K, V> *current, Tree<K, V> *parent);
-  void RemoveNode_(Tree<K, V> *current, Tree<K, V> *parent);
+  Tree()
+      : root_(nullptr), leftmost_(nullptr), rightmost_(nullptr), size_(0) {}
+  explicit Tree(const value_type &elem);
+  Tree(std::initializer_list<value_type> const &items);
+  // Builds a perfectly balanced tree in O(n) when the range is strictly
+  // increasing, and inserts element by element otherwise.
+  template <typename InputIt>
+  Tree(InputIt first, InputIt last);
+  // Copies the structure node for node, in O(n).
+  Tree(const Tree &other);
+  Tree(Tree &&other) noexcept;
+  ~Tree();
 
- public:
-  using const_iterator = ConstIterator;
-  using iterator = Iterator;
+  Tree &operator=(const Tree &other);
+  Tree &operator=(Tree &&other) noexcept;
 
+  // begin() is the smallest element and end() the largest; both throw on
+  // an empty tree. Searches that run off the largest element return the
+  // null position, which compares equal to iterator().
   iterator begin() const {
-    if (!left_ && !right_ && !root_)
-      throw std::out_of_range("Tree does not exist");
-    const Tree<K, V> *tmp_this = this;
-    Tree<K, V> *min_tr = FindMin(left_ ? left_ : tmp_this);
-    return Iterator(min_tr);
+    if (!root_) throw std::out_of_range("Tree does not exist");
+    return MakeIterator_(leftmost_);
   }
-
   iterator end() const {
-    if (!left_ && !right_ && !root_)
-      throw std::out_of_range("Tree does not exist");
-    const Tree<K, V> *tmp_this = this;
-    Tree<K, V> *max_tr = FindMax(right_ ? right_ : tmp_this);
-    return Iterator(max_tr);
+    if (!root_) throw std::out_of_range("Tree does not exist");
+    return MakeIterator_(rightmost_);
   }
 
+  template <typename InputIt>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> const &items) {
+    assign(items.begin(), items.end());
+  }
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void clear();
+  // Moves the nodes of other whose keys are not here yet into this tree,
+  // without copying them; the rest stay in other. Relinks node by node
+  // when other is small and in one linear pass otherwise.
+  void merge(Tree &other);
+  // Appends other, whose keys must all be greater than ours, in O(log n);
+  // throws std::logic_error otherwise. Leaves other empty.
+  void join(Tree &other);
+  void swap(Tree &other);
+  bool contains(const K &key) const;
+
+  std::pair<iterator, bool> insert(const value_type &value);
   void erase(iterator pos);
-  virtual std::pair<iterator, bool> insert(const value_type &value);
+  size_type erase(const K &key);
+  // Unlinks an element without destroying it.
+  node_type extract(iterator pos);
+  node_type extract(const K &key);
+  // Links in the handle's node unless its key is present, in which case
+  // the handle keeps it.
+  std::pair<iterator, bool> insert(node_type &&node);
+  // Insert next to hint: a key that belongs right before or right after
+  // the hint's element (after the largest one for a null hint) is linked
+  // in without a search, and any other key is placed as usual. Appending
+  // after the largest element, or in order after the previous insert, is
+  // amortized O(1) with order_stats::off; with counts every ancestor still
+  // has to be updated. Returns the element with the key.
+  iterator insert(const_iterator hint, const value_type &value);
+  template <typename... Args>
+  iterator emplace_hint(const_iterator hint, Args &&...args);
 
-  Tree<K, V> *GetTree_(iterator pos) { return pos.GetTree(); }
-  Node_ *GetNode_(iterator pos) { return pos.GetNode(); }
+  // Throws std::out_of_range when key is missing.
+  iterator find(const K &key) const;
+  size_type count(const K &key) const;
+  // First element not less than key / greater than key.
+  iterator lower_bound(const K &key) const;
+  iterator upper_bound(const K &key) const;
+  std::pair<iterator, iterator> equal_range(const K &key) const;
+
+  // Only with order_stats::on.
+  // The element with k smaller ones; throws when k >= size().
+  iterator nth_element(size_type k) const;
+  // Elements less than key.
+  size_type rank(const K &key) const;
+  // Elements in [low, high).
+  size_type count_range(const K &low, const K &high) const;
 
   template <typename... Args>
   std::vector<std::pair<iterator, bool>> emplace(Args &&...args) {
     std::vector<std::pair<iterator, bool>> res_vec;
-    for (auto elem : {std::forward<Args>(args)...}) {
+    for (auto elem : {std::forward<Args>(args)...})
       res_vec.push_back(insert(elem));
-    }
     return res_vec;
   }
+
+ protected:
+  Node_ *root_;
+  // The smallest and largest elements, kept by Link_ and Unlink_ and
+  // looked up again by FindEnds_ after bulk changes.
+  Node_ *leftmost_;
+  Node_ *rightmost_;
+  size_type size_;
+
+  static const K &KeyOf_(const Node_ *node) {
+    return Traits_::KeyOf(node->value_);
+  }
+  iterator MakeIterator_(Node_ *node) const { return iterator(node, this); }
+
+  Node_ *FindNode_(const K &key) const;
+  Node_ *LowerBound_(const K &key) const;
+  Node_ *UpperBound_(const K &key) const;
+  // Finds key, or builds its element from args and links it in.
+  template <typename... Args>
+  std::pair<Node_ *, bool> Insert_(const K &key, Args &&...args);
+  // Moves the elements not less than key into right. With order_stats::on
+  // this is O(log n); with order_stats::off the smaller side is walked to
+  // learn the sizes, for O(log n + smaller part).
+  void SplitOff_(const K &key, Tree &right);
+  void FindEnds_();
+  // Elements in node's subtree: O(1) with order statistics, O(n) without.
+  static size_type SizeOf_(const Node_ *node);
+
+ private:
+  static Node_ *Min_(Node_ *node);
+  static Node_ *Max_(Node_ *node);
+  static Node_ *Next_(Node_ *node);
+  static Node_ *Prev_(Node_ *node);
+  static int Height_(const Node_ *node) { return node ? node->height_ : 0; }
+  static size_type CountOf_(const Node_ *node) {
+    return node ? node->count_ : 0;
+  }
+  static int BalanceFactor_(const Node_ *node) {
+    return Height_(node->right_) - Height_(node->left_);
+  }
+  // Recomputes height, and count if kept, from the children.
+  static void Update_(Node_ *node);
+  static void Destroy_(Node_ *node);
+  static bool KeyLess_(const K &a, const K &b) { return a < b; }
+  static Node_ *Clone_(const Node_ *node, Node_ *parent);
+  // Builds a subtree from the next n elements of a sorted range.
+  template <typename ForwardIt>
+  static Node_ *Build_(ForwardIt &it, size_type n, Node_ *parent);
+  // Appends the subtree, in order, to a list linked through right_.
+  static void Flatten_(Node_ *node, Node_ **&tail);
+  // Builds a subtree from the first n nodes of such a list.
+  static Node_ *Relink_(Node_ *&list, size_type n, Node_ *parent);
+  static void Split_(Node_ *node, const K &key, Tree &left, Tree &right);
+
+  template <typename InputIt>
+  void Fill_(InputIt first, InputIt last, std::input_iterator_tag);
+  template <typename ForwardIt>
+  void Fill_(ForwardIt first, ForwardIt last, std::forward_iterator_tag);
+
+  // Puts replacement where node hangs: under node's parent, or at the root.
+  void Replace_(Node_ *node, Node_ *replacement);
+  Node_ *RotateLeft_(Node_ *node);
+  Node_ *RotateRight_(Node_ *node);
+  // Returns the root of node's subtree after the fix-up.
+  Node_ *Balance_(Node_ *node);
+  void RebalanceUp_(Node_ *node);
+  // Returns the node holding key, or null with link and parent set to
+  // where a node for key would go.
+  Node_ *Locate_(const K &key, Node_ **&link, Node_ *&parent);
+  // Locate_, trying the neighbourhood of hint first.
+  Node_ *LocateNear_(Node_ *hint, const K &key, Node_ **&link,
+                     Node_ *&parent);
+  void Link_(Node_ *node, Node_ **link, Node_ *parent);
+  void Unlink_(Node_ *node);
+  // Joins this tree, mid and right, in key order, into this tree. Leaves
+  // size_ to the caller.
+  void Join_(Node_ *mid, Tree &right);
 };
 }  // namespace s21
 
 #include "s21_avl_tree.cpp"
 
-#endif
\ No newline at end of file
+#endif
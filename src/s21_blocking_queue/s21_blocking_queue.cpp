@@ -0,0 +1,169 @@
+#include "s21_blocking_queue.h"
+
+using namespace s21;
+
+template <typename T>
+blocking_queue<T>::blocking_queue(size_type capacity)
+    : waiting_producers_(0),
+      waiting_consumers_(0),
+      buffer_(capacity, overflow_policy::reject),
+      closed_(false) {
+  if (capacity == 0)
+    throw std::length_error("Blocking queue needs a non-zero capacity");
+}
+
+template <typename T>
+bool blocking_queue<T>::try_push(const_reference value) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (closed_ || buffer_.full()) return false;
+  buffer_.push_back(value);
+  size_type waiters = waiting_consumers_;
+  lock.unlock();
+  Wake_(not_empty_, waiters, 1);
+  return true;
+}
+
+template <typename T>
+typename blocking_queue<T>::size_type blocking_queue<T>::push_bulk(
+    const value_type *src, size_type n) {
+  size_type pushed = 0;
+  while (pushed < n) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!WaitNotFull_(lock)) break;
+    size_type start = pushed;
+    while (pushed < n && !buffer_.full()) buffer_.push_back(src[pushed++]);
+    size_type waiters = waiting_consumers_;
+    lock.unlock();
+    Wake_(not_empty_, waiters, pushed - start);
+  }
+  return pushed;
+}
+
+template <typename T>
+bool blocking_queue<T>::pop(reference out) {
+  return pop_bulk(&out, 1) == 1;
+}
+
+template <typename T>
+template <typename Rep, typename Period>
+bool blocking_queue<T>::pop_wait(
+    reference out, const std::chrono::duration<Rep, Period> &timeout) {
+  auto deadline = std::chrono::steady_clock::now() + timeout;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (buffer_.empty() && !closed_) {
+    ++waiting_consumers_;
+    std::cv_status status = not_empty_.wait_until(lock, deadline);
+    --waiting_consumers_;
+    if (status == std::cv_status::timeout && buffer_.empty()) return false;
+  }
+  T *dst = &out;
+  if (Drain_(dst, 1) == 0) return false;
+  size_type waiters = waiting_producers_;
+  lock.unlock();
+  Wake_(not_full_, waiters, 1);
+  return true;
+}
+
+template <typename T>
+bool blocking_queue<T>::try_pop(reference out) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  T *dst = &out;
+  if (Drain_(dst, 1) == 0) return false;
+  size_type waiters = waiting_producers_;
+  lock.unlock();
+  Wake_(not_full_, waiters, 1);
+  return true;
+}
+
+template <typename T>
+template <typename OutputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::pop_bulk(
+    OutputIt out, size_type max) {
+  if (max == 0) return 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!WaitNotEmpty_(lock)) return 0;
+  size_type n = Drain_(out, max);
+  size_type waiters = waiting_producers_;
+  lock.unlock();
+  Wake_(not_full_, waiters, n);
+  return n;
+}
+
+template <typename T>
+void blocking_queue<T>::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  not_full_.notify_all();
+  not_empty_.notify_all();
+}
+
+template <typename T>
+bool blocking_queue<T>::closed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return closed_;
+}
+
+template <typename T>
+typename blocking_queue<T>::size_type blocking_queue<T>::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return buffer_.size();
+}
+
+template <typename T>
+template <typename U>
+bool blocking_queue<T>::Push_(U &&value) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (!WaitNotFull_(lock)) return false;
+  buffer_.push_back(std::forward<U>(value));
+  size_type waiters = waiting_consumers_;
+  lock.unlock();
+  Wake_(not_empty_, waiters, 1);
+  return true;
+}
+
+// Returns false if the queue was closed while waiting.
+template <typename T>
+bool blocking_queue<T>::WaitNotFull_(std::unique_lock<std::mutex> &lock) {
+  while (buffer_.full() && !closed_) {
+    ++waiting_producers_;
+    not_full_.wait(lock);
+    --waiting_producers_;
+  }
+  return !closed_;
+}
+
+// Returns false if the queue is closed and drained.
+template <typename T>
+bool blocking_queue<T>::WaitNotEmpty_(std::unique_lock<std::mutex> &lock) {
+  while (buffer_.empty() && !closed_) {
+    ++waiting_consumers_;
+    not_empty_.wait(lock);
+    --waiting_consumers_;
+  }
+  return !buffer_.empty();
+}
+
+template <typename T>
+template <typename OutputIt>
+typename blocking_queue<T>::size_type blocking_queue<T>::Drain_(
+    OutputIt &out, size_type max) {
+  size_type n = 0;
+  for (; n < max && !buffer_.empty(); ++n) {
+    *out = std::move(buffer_.front());
+    ++out;
+    buffer_.pop_front();
+  }
+  return n;
+}
+
+template <typename T>
+void blocking_queue<T>::Wake_(std::condition_variable &cv, size_type waiters,
+                              size_type n) {
+  if (n >= waiters) {
+    if (waiters != 0) cv.notify_all();
+  } else {
+    while (n-- != 0) cv.notify_one();
+  }
+}
@@ -0,0 +1,82 @@
+#ifndef S21_BLOCKING_QUEUE_H_
+#define S21_BLOCKING_QUEUE_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <utility>
+
+#include "../s21_circular_buffer/s21_circular_buffer.h"
+
+namespace s21 {
+// Bounded queue for handing work between threads. Producers block while it
+// is full and consumers while it is empty, which pushes back on a stage
+// that runs ahead of the next one. Waiters are counted, so a thread only
+// signals when someone is asleep, wakes no more threads than there are
+// items or slots for them, and signals after releasing the mutex so the
+// woken thread does not immediately block on it again.
+//
+// After close() pushes fail and blocked threads wake up; consumers still
+// drain what is left before their pops start failing.
+template <typename T>
+class blocking_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit blocking_queue(size_type capacity);
+  blocking_queue(const blocking_queue &) = delete;
+  blocking_queue &operator=(const blocking_queue &) = delete;
+
+  // Return false if the queue is closed.
+  bool push(const_reference value) { return Push_(value); }
+  bool push(value_type &&value) { return Push_(std::move(value)); }
+  bool try_push(const_reference value);
+  // Pushes n elements under as few lock acquisitions as the free space
+  // allows; returns how many were pushed before the queue was closed.
+  size_type push_bulk(const value_type *src, size_type n);
+
+  // Return false once the queue is closed and drained, or on timeout.
+  bool pop(reference out);
+  template <typename Rep, typename Period>
+  bool pop_wait(reference out,
+                const std::chrono::duration<Rep, Period> &timeout);
+  bool try_pop(reference out);
+  // Waits for at least one element, then moves up to max elements to out
+  // with one lock acquisition. Returns 0 once the queue is closed and
+  // drained.
+  template <typename OutputIt>
+  size_type pop_bulk(OutputIt out, size_type max);
+
+  void close();
+  bool closed() const;
+  size_type size() const;
+  size_type capacity() const { return buffer_.capacity(); }
+
+ private:
+  mutable std::mutex mutex_;
+  std::condition_variable not_full_;
+  std::condition_variable not_empty_;
+  size_type waiting_producers_;
+  size_type waiting_consumers_;
+  circular_buffer<T> buffer_;
+  bool closed_;
+
+  template <typename U>
+  bool Push_(U &&value);
+  bool WaitNotFull_(std::unique_lock<std::mutex> &lock);
+  bool WaitNotEmpty_(std::unique_lock<std::mutex> &lock);
+  // Moves up to max elements out; returns how many.
+  template <typename OutputIt>
+  size_type Drain_(OutputIt &out, size_type max);
+  // Signals up to n of the given waiters; call without holding the mutex.
+  static void Wake_(std::condition_variable &cv, size_type waiters,
+                    size_type n);
+};
+}  // namespace s21
+
+#include "s21_blocking_queue.cpp"
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef S21_BUFFER_QUEUE_H_
+#define S21_BUFFER_QUEUE_H_
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <climits>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
+
+namespace s21 {
+// Queue of outgoing byte buffers that is flushed with gather writes. The
+// queued buffers are handed to writev as they are, up to IOV_MAX at a
+// time, so nothing is copied into a staging buffer and one syscall covers
+// many buffers. After a short write the queue resumes inside the first
+// unwritten buffer.
+class buffer_queue {
+ public:
+  using size_type = size_t;
+
+  buffer_queue() : offset_(0), bytes_(0) {}
+
+  // Takes ownership of the bytes; empty buffers are ignored.
+  void push(std::string buffer);
+  void push(const char *data, size_type n) { push(std::string(data, n)); }
+
+  bool empty() const { return bytes_ == 0; }
+  // Buffers not yet fully written.
+  size_type size() const { return buffers_.size(); }
+  // Bytes not yet written.
+  size_type bytes() const { return bytes_; }
+
+  // Writes as much as fd accepts and returns the number of bytes written.
+  // Stops early when a non-blocking fd would block. Other errors throw
+  // std::system_error; whatever was written before stays consumed.
+  size_type drain_to(int fd);
+  void clear();
+
+ private:
+#ifdef IOV_MAX
+  static constexpr size_type kMaxIov_ = IOV_MAX;
+#else
+  static constexpr size_type kMaxIov_ = 16;
+#endif
+
+  deque<std::string> buffers_;
+  // Bytes of buffers_.front() that were already written.
+  size_type offset_;
+  size_type bytes_;
+
+  void Consume_(size_type n);
+};
+
+inline void buffer_queue::push(std::string buffer) {
+  if (buffer.empty()) return;
+  bytes_ += buffer.size();
+  buffers_.push_back(std::move(buffer));
+}
+
+inline buffer_queue::size_type buffer_queue::drain_to(int fd) {
+  iovec iov[kMaxIov_];
+  size_type total = 0;
+  while (!empty()) {
+    size_type count = 0;
+    size_type wanted = 0;
+    for (; count < kMaxIov_ && count < buffers_.size(); ++count) {
+      std::string &buffer = buffers_[count];
+      size_type skip = count == 0 ? offset_ : 0;
+      iov[count].iov_base = &buffer[skip];
+      iov[count].iov_len = buffer.size() - skip;
+      wanted += iov[count].iov_len;
+    }
+    ssize_t written = ::writev(fd, iov, static_cast<int>(count));
+    if (written < 0) {
+      if (errno == EINTR) continue;
+      if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+      throw std::system_error(errno, std::generic_category(), "writev");
+    }
+    Consume_(static_cast<size_type>(written));
+    total += static_cast<size_type>(written);
+    // A short write means the fd is full for now.
+    if (static_cast<size_type>(written) < wanted) break;
+  }
+  return total;
+}
+
+inline void buffer_queue::clear() {
+  buffers_.clear();
+  offset_ = 0;
+  bytes_ = 0;
+}
+
+inline void buffer_queue::Consume_(size_type n) {
+  bytes_ -= n;
+  while (n != 0) {
+    size_type left = buffers_.front().size() - offset_;
+    if (n < left) {
+      offset_ += n;
+      return;
+    }
+    n -= left;
+    buffers_.pop_front();
+    offset_ = 0;
+  }
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,195 @@
+#ifndef S21_CHANNEL_H_
+#define S21_CHANNEL_H_
+
+#include <coroutine>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
+#include "../s21_intrusive_list/s21_intrusive_list.h"
+#include "s21_task.h"
+
+namespace s21 {
+// A queue between coroutines. `co_await ch.send(x)` suspends the sender
+// while a bounded channel is full and `co_await ch.recv()` suspends the
+// receiver while the channel is empty; neither blocks its thread, so the
+// executor runs other coroutines meanwhile. A suspended coroutine is put
+// back on the executor it was running on when the other side lets it
+// continue. Channels may be shared by coroutines on different executors
+// and threads.
+//
+// Suspended senders and receivers wait on intrusive lists of their
+// awaiters, which live in the coroutine frames, so waiting allocates
+// nothing. After close() sends fail, waiters wake up and receivers still
+// drain the buffered values.
+template <typename T>
+class channel {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  class send_awaiter;
+  class recv_awaiter;
+
+  // Unbounded: sends never suspend.
+  channel() : channel(std::numeric_limits<size_type>::max()) {}
+  // Bounded. With capacity 0 every send waits for a receiver to take the
+  // value directly.
+  explicit channel(size_type capacity) : capacity_(capacity), closed_(false) {}
+  channel(const channel &) = delete;
+  channel &operator=(const channel &) = delete;
+
+  // Awaiting yields false if the channel was closed.
+  send_awaiter send(value_type value) {
+    return send_awaiter(*this, std::move(value));
+  }
+  // Awaiting yields the value, or nothing once the channel is closed and
+  // drained.
+  recv_awaiter recv() { return recv_awaiter(*this); }
+
+  void close();
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+  size_type size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.size();
+  }
+  size_type capacity() const { return capacity_; }
+
+  class send_awaiter {
+   public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    bool await_resume() const noexcept { return sent_; }
+
+   private:
+    friend class channel;
+
+    channel &channel_;
+    value_type value_;
+    bool sent_;
+    std::coroutine_handle<> handle_;
+    coro_executor *executor_;
+    list_hook<> hook_;
+
+    send_awaiter(channel &ch, value_type &&value)
+        : channel_(ch), value_(std::move(value)), sent_(false) {}
+  };
+
+  class recv_awaiter {
+   public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    std::optional<value_type> await_resume() { return std::move(value_); }
+
+   private:
+    friend class channel;
+
+    channel &channel_;
+    std::optional<value_type> value_;
+    std::coroutine_handle<> handle_;
+    coro_executor *executor_;
+    list_hook<> hook_;
+
+    explicit recv_awaiter(channel &ch) : channel_(ch) {}
+  };
+
+ private:
+  mutable std::mutex mutex_;
+  s21::deque<T> buffer_;
+  intrusive_list<send_awaiter, list_hook<>, &send_awaiter::hook_> senders_;
+  intrusive_list<recv_awaiter, list_hook<>, &recv_awaiter::hook_> receivers_;
+  size_type capacity_;
+  bool closed_;
+
+  // Called without the mutex: once the coroutine is scheduled another
+  // thread may resume it and free its awaiter.
+  static void Wake_(std::coroutine_handle<> handle, coro_executor *executor) {
+    if (executor)
+      executor->schedule(handle);
+    else
+      handle.resume();
+  }
+};
+
+template <typename T>
+bool channel<T>::send_awaiter::await_suspend(std::coroutine_handle<> handle) {
+  std::unique_lock<std::mutex> lock(channel_.mutex_);
+  if (channel_.closed_) return false;
+  if (!channel_.receivers_.empty()) {
+    recv_awaiter &receiver = channel_.receivers_.front();
+    channel_.receivers_.pop_front();
+    receiver.value_.emplace(std::move(value_));
+    sent_ = true;
+    std::coroutine_handle<> other = receiver.handle_;
+    coro_executor *executor = receiver.executor_;
+    lock.unlock();
+    Wake_(other, executor);
+    return false;
+  }
+  if (channel_.buffer_.size() < channel_.capacity_) {
+    channel_.buffer_.push_back(std::move(value_));
+    sent_ = true;
+    return false;
+  }
+  handle_ = handle;
+  executor_ = coro_executor::current();
+  channel_.senders_.push_back(*this);
+  return true;
+}
+
+template <typename T>
+bool channel<T>::recv_awaiter::await_suspend(std::coroutine_handle<> handle) {
+  std::unique_lock<std::mutex> lock(channel_.mutex_);
+  if (!channel_.buffer_.empty()) {
+    value_.emplace(std::move(channel_.buffer_.front()));
+    channel_.buffer_.pop_front();
+  }
+  if (!channel_.senders_.empty()) {
+    // A slot just freed up, or with capacity 0 the sender hands over.
+    send_awaiter &sender = channel_.senders_.front();
+    channel_.senders_.pop_front();
+    if (value_)
+      channel_.buffer_.push_back(std::move(sender.value_));
+    else
+      value_.emplace(std::move(sender.value_));
+    sender.sent_ = true;
+    std::coroutine_handle<> other = sender.handle_;
+    coro_executor *executor = sender.executor_;
+    lock.unlock();
+    Wake_(other, executor);
+    return false;
+  }
+  if (value_ || channel_.closed_) return false;
+  handle_ = handle;
+  executor_ = coro_executor::current();
+  channel_.receivers_.push_back(*this);
+  return true;
+}
+
+template <typename T>
+void channel<T>::close() {
+  s21::deque<std::pair<std::coroutine_handle<>, coro_executor *>> waiters;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    while (!senders_.empty()) {
+      send_awaiter &sender = senders_.front();
+      senders_.pop_front();
+      waiters.push_back({sender.handle_, sender.executor_});
+    }
+    while (!receivers_.empty()) {
+      recv_awaiter &receiver = receivers_.front();
+      receivers_.pop_front();
+      waiters.push_back({receiver.handle_, receiver.executor_});
+    }
+  }
+  for (auto &waiter : waiters) Wake_(waiter.first, waiter.second);
+}
+}  // namespace s21
+
+#endif
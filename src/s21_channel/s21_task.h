@@ -0,0 +1,231 @@
+#ifndef S21_TASK_H_
+#define S21_TASK_H_
+
+#if __cplusplus < 202002L
+#error "s21_task.h needs C++20 coroutines; build with make test_cpp20"
+#endif
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
+
+namespace s21 {
+class coro_executor;
+
+// A fire-and-forget coroutine. It does nothing until it is handed to an
+// executor with spawn(); from then on the executor owns the frame, which is
+// freed when the coroutine returns.
+class task {
+ public:
+  struct promise_type {
+    coro_executor *executor_ = nullptr;
+    std::exception_ptr error_;
+
+    task get_return_object() {
+      return task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    auto final_suspend() noexcept;
+    void return_void() {}
+    void unhandled_exception() { error_ = std::current_exception(); }
+  };
+
+  task(task &&other) : handle_(std::exchange(other.handle_, nullptr)) {}
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+  task &operator=(task &&) = delete;
+  ~task() {
+    if (handle_) handle_.destroy();
+  }
+
+ private:
+  friend class coro_executor;
+
+  std::coroutine_handle<promise_type> handle_;
+
+  explicit task(std::coroutine_handle<promise_type> handle)
+      : handle_(handle) {}
+};
+
+// Runs coroutines. Awaitables such as s21::channel remember the executor a
+// coroutine was running on when it suspended and hand the coroutine back to
+// it through schedule() when it can continue.
+class coro_executor {
+ public:
+  coro_executor() : live_(0) {}
+  coro_executor(const coro_executor &) = delete;
+  coro_executor &operator=(const coro_executor &) = delete;
+  virtual ~coro_executor() = default;
+
+  virtual void schedule(std::coroutine_handle<> handle) = 0;
+
+  void spawn(task t) {
+    std::coroutine_handle<task::promise_type> handle =
+        std::exchange(t.handle_, nullptr);
+    handle.promise().executor_ = this;
+    {
+      std::lock_guard<std::mutex> lock(state_mutex_);
+      ++live_;
+    }
+    schedule(handle);
+  }
+
+  // The executor running the calling thread's current coroutine, or null.
+  static coro_executor *current() { return Current_(); }
+
+ protected:
+  void Resume_(std::coroutine_handle<> handle) {
+    coro_executor *outer = std::exchange(Current_(), this);
+    handle.resume();
+    Current_() = outer;
+  }
+
+  size_t Live_() {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    return live_;
+  }
+  void WaitIdle_() {
+    std::unique_lock<std::mutex> lock(state_mutex_);
+    idle_.wait(lock, [this] { return live_ == 0; });
+  }
+  // Rethrows the first exception that escaped a spawned task.
+  void RethrowIfFailed_() {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (error_) std::rethrow_exception(std::exchange(error_, nullptr));
+  }
+
+ private:
+  friend struct task::promise_type;
+
+  std::mutex state_mutex_;
+  std::condition_variable idle_;
+  size_t live_;
+  std::exception_ptr error_;
+
+  static coro_executor *&Current_() {
+    thread_local coro_executor *current = nullptr;
+    return current;
+  }
+
+  void TaskDone_(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(state_mutex_);
+    if (error && !error_) error_ = std::move(error);
+    if (--live_ == 0) idle_.notify_all();
+  }
+};
+
+inline auto task::promise_type::final_suspend() noexcept {
+  struct FinalAwaiter {
+    bool await_ready() noexcept { return false; }
+    // Frees the frame before reporting, so that an executor that sees no
+    // live tasks also has no frames left to free.
+    void await_suspend(std::coroutine_handle<promise_type> handle) noexcept {
+      coro_executor *executor = handle.promise().executor_;
+      std::exception_ptr error = std::move(handle.promise().error_);
+      handle.destroy();
+      executor->TaskDone_(std::move(error));
+    }
+    void await_resume() noexcept {}
+  };
+  return FinalAwaiter{};
+}
+
+// Runs everything on the thread that calls run(). schedule() may be called
+// from any thread.
+class single_thread_executor : public coro_executor {
+ public:
+  void schedule(std::coroutine_handle<> handle) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ready_.push_back(handle);
+  }
+
+  // Resumes ready coroutines until none is left, then rethrows the first
+  // exception a task let escape. Returns the number of tasks that are still
+  // suspended, waiting for something outside this executor.
+  size_t run() {
+    for (;;) {
+      std::coroutine_handle<> handle;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready_.empty()) break;
+        handle = ready_.front();
+        ready_.pop_front();
+      }
+      Resume_(handle);
+    }
+    RethrowIfFailed_();
+    return Live_();
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::deque<std::coroutine_handle<>> ready_;
+};
+
+// A fixed set of worker threads sharing one ready queue.
+class thread_pool_executor : public coro_executor {
+ public:
+  explicit thread_pool_executor(
+      size_t threads = std::thread::hardware_concurrency())
+      : stop_(false) {
+    if (threads == 0) threads = 1;
+    for (size_t i = 0; i < threads; ++i)
+      workers_.push_back(std::thread([this] { Work_(); }));
+  }
+  // Finishes the coroutines that are ready, then joins the workers.
+  ~thread_pool_executor() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    ready_cv_.notify_all();
+    for (std::thread &worker : workers_) worker.join();
+  }
+
+  void schedule(std::coroutine_handle<> handle) override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ready_.push_back(handle);
+    }
+    ready_cv_.notify_one();
+  }
+
+  // Blocks until every spawned task has returned, then rethrows the first
+  // exception a task let escape.
+  void wait() {
+    WaitIdle_();
+    RethrowIfFailed_();
+  }
+
+  size_t size() const { return workers_.size(); }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable ready_cv_;
+  s21::deque<std::coroutine_handle<>> ready_;
+  bool stop_;
+  s21::deque<std::thread> workers_;
+
+  void Work_() {
+    for (;;) {
+      std::coroutine_handle<> handle;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ready_cv_.wait(lock, [this] { return stop_ || !ready_.empty(); });
+        if (ready_.empty()) return;
+        handle = ready_.front();
+        ready_.pop_front();
+      }
+      Resume_(handle);
+    }
+  }
+};
+}  // namespace s21
+
+#endif
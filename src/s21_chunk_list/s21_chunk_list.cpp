@@ -0,0 +1,153 @@
+#include "s21_chunk_list.h"
+
+using namespace s21;
+
+template <typename T>
+chunk_list<T>::chunk_list()
+    : head_(nullptr),
+      tail_(nullptr),
+      used_(0),
+      size_(0),
+      spare_(nullptr) {}
+
+template <typename T>
+chunk_list<T>::chunk_list(std::initializer_list<value_type> const &items)
+    : chunk_list() {
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T>
+chunk_list<T>::chunk_list(const chunk_list &other) : chunk_list() {
+  for (Chunk_ *chunk = other.head_; chunk != nullptr; chunk = chunk->next_) {
+    size_type n = chunk == other.tail_ ? other.used_ : kChunkSize_;
+    for (size_type i = 0; i < n; ++i) push_back(*chunk->Slot_(i));
+  }
+}
+
+template <typename T>
+chunk_list<T>::chunk_list(chunk_list &&other) : chunk_list() {
+  swap(other);
+}
+
+template <typename T>
+chunk_list<T>::~chunk_list() {
+  clear();
+  shrink_to_fit();
+}
+
+template <typename T>
+chunk_list<T> &chunk_list<T>::operator=(const chunk_list &other) {
+  if (this != &other) {
+    chunk_list tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+chunk_list<T> &chunk_list<T>::operator=(chunk_list &&other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T>
+typename chunk_list<T>::reference chunk_list<T>::back() {
+  if (size_ == 0) throw std::out_of_range("Chunk list is empty");
+  return *tail_->Slot_(used_ - 1);
+}
+
+template <typename T>
+typename chunk_list<T>::const_reference chunk_list<T>::back() const {
+  if (size_ == 0) throw std::out_of_range("Chunk list is empty");
+  return *tail_->Slot_(used_ - 1);
+}
+
+template <typename T>
+void chunk_list<T>::clear() {
+  while (size_ != 0) pop_back();
+}
+
+template <typename T>
+template <typename... Args>
+typename chunk_list<T>::reference chunk_list<T>::emplace_back(
+    Args &&...args) {
+  if (tail_ != nullptr && used_ != kChunkSize_) {
+    T *slot = new (tail_->Slot_(used_)) T(std::forward<Args>(args)...);
+    ++used_;
+    ++size_;
+    return *slot;
+  }
+  // Construct before linking, so a throwing constructor leaves no empty
+  // chunk at the back.
+  Chunk_ *chunk = NewChunk_();
+  T *slot;
+  try {
+    slot = new (chunk->Slot_(0)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    ReleaseChunk_(chunk);
+    throw;
+  }
+  chunk->prev_ = tail_;
+  chunk->next_ = nullptr;
+  if (tail_ != nullptr)
+    tail_->next_ = chunk;
+  else
+    head_ = chunk;
+  tail_ = chunk;
+  used_ = 1;
+  ++size_;
+  return *slot;
+}
+
+template <typename T>
+void chunk_list<T>::pop_back() {
+  if (size_ == 0) throw std::out_of_range("Chunk list is empty");
+  tail_->Slot_(--used_)->~T();
+  --size_;
+  if (used_ == 0) {
+    Chunk_ *chunk = tail_;
+    tail_ = chunk->prev_;
+    if (tail_ != nullptr)
+      tail_->next_ = nullptr;
+    else
+      head_ = nullptr;
+    used_ = tail_ != nullptr ? kChunkSize_ : 0;
+    ReleaseChunk_(chunk);
+  }
+}
+
+template <typename T>
+void chunk_list<T>::swap(chunk_list &other) {
+  std::swap(head_, other.head_);
+  std::swap(tail_, other.tail_);
+  std::swap(used_, other.used_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+template <typename T>
+void chunk_list<T>::shrink_to_fit() {
+  delete spare_;
+  spare_ = nullptr;
+}
+
+template <typename T>
+typename chunk_list<T>::Chunk_ *chunk_list<T>::NewChunk_() {
+  Chunk_ *chunk = spare_;
+  if (chunk != nullptr)
+    spare_ = nullptr;
+  else
+    chunk = new Chunk_;
+  return chunk;
+}
+
+template <typename T>
+void chunk_list<T>::ReleaseChunk_(Chunk_ *chunk) {
+  if (spare_ == nullptr)
+    spare_ = chunk;
+  else
+    delete chunk;
+}
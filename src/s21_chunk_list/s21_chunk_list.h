@@ -0,0 +1,80 @@
+#ifndef S21_CHUNK_LIST_H_
+#define S21_CHUNK_LIST_H_
+
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Back-only sequence over a linked list of fixed-size chunks, meant as the
+// container of s21::stack when the stack gets deep:
+//
+//   s21::stack<Frame, s21::chunk_list<Frame>> dfs;
+//
+// Growing links a new chunk instead of reallocating, so push_back and
+// pop_back are O(1) in the worst case, existing elements are never copied
+// or moved and references to them stay valid until they are popped. The
+// last emptied chunk is kept as a spare, so pushing and popping across a
+// chunk boundary does not allocate.
+template <typename T>
+class chunk_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  chunk_list();
+  chunk_list(std::initializer_list<value_type> const &items);
+  chunk_list(const chunk_list &other);
+  chunk_list(chunk_list &&other);
+  ~chunk_list();
+
+  chunk_list &operator=(const chunk_list &other);
+  chunk_list &operator=(chunk_list &&other);
+
+  reference back();
+  const_reference back() const;
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  void clear();
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void swap(chunk_list &other);
+  // Frees the spare chunk kept for reuse.
+  void shrink_to_fit();
+
+ private:
+  static constexpr size_type kChunkBytes_ = 4096;
+  static constexpr size_type kChunkSize_ =
+      sizeof(T) * 16 > kChunkBytes_ ? 16 : kChunkBytes_ / sizeof(T);
+
+  struct Chunk_ {
+    Chunk_ *prev_;
+    Chunk_ *next_;
+    alignas(T) unsigned char storage_[kChunkSize_ * sizeof(T)];
+    T *Slot_(size_type i) { return reinterpret_cast<T *>(storage_) + i; }
+  };
+
+  Chunk_ *head_;
+  // The last chunk; it holds used_ elements and is never empty unless the
+  // whole list is.
+  Chunk_ *tail_;
+  size_type used_;
+  size_type size_;
+  Chunk_ *spare_;
+
+  Chunk_ *NewChunk_();
+  void ReleaseChunk_(Chunk_ *chunk);
+};
+}  // namespace s21
+
+#include "s21_chunk_list.cpp"
+
+#endif
@@ -0,0 +1,204 @@
+#include "s21_circular_buffer.h"
+
+using namespace s21;
+
+template <typename T>
+circular_buffer<T>::circular_buffer()
+    : arr_(nullptr),
+      capacity_(0),
+      head_(0),
+      size_(0),
+      policy_(overflow_policy::overwrite) {}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(size_type capacity, overflow_policy policy)
+    : arr_(capacity ? static_cast<T *>(::operator new(capacity * sizeof(T)))
+                    : nullptr),
+      capacity_(capacity),
+      head_(0),
+      size_(0),
+      policy_(policy) {}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(
+    std::initializer_list<value_type> const &items)
+    : circular_buffer(items.size()) {
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(const circular_buffer &other)
+    : circular_buffer(other.capacity_, other.policy_) {
+  for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+}
+
+template <typename T>
+circular_buffer<T>::circular_buffer(circular_buffer &&other)
+    : circular_buffer() {
+  swap(other);
+}
+
+template <typename T>
+circular_buffer<T>::~circular_buffer() {
+  clear();
+  ::operator delete(arr_);
+}
+
+template <typename T>
+circular_buffer<T> &circular_buffer<T>::operator=(
+    const circular_buffer &other) {
+  if (this != &other) {
+    circular_buffer tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+circular_buffer<T> &circular_buffer<T>::operator=(circular_buffer &&other) {
+  if (this != &other) {
+    circular_buffer tmp(std::move(other));
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return arr_[Index_(pos)];
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::at(
+    size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return arr_[Index_(pos)];
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::front() {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  return arr_[head_];
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::front()
+    const {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  return arr_[head_];
+}
+
+template <typename T>
+typename circular_buffer<T>::reference circular_buffer<T>::back() {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  return arr_[Index_(size_ - 1)];
+}
+
+template <typename T>
+typename circular_buffer<T>::const_reference circular_buffer<T>::back() const {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  return arr_[Index_(size_ - 1)];
+}
+
+template <typename T>
+void circular_buffer<T>::set_capacity(size_type capacity) {
+  if (capacity == capacity_) return;
+  circular_buffer tmp(capacity, policy_);
+  size_type skip = size_ > capacity ? size_ - capacity : 0;
+  for (size_type i = skip; i < size_; ++i)
+    tmp.push_back(std::move(arr_[Index_(i)]));
+  swap(tmp);
+}
+
+template <typename T>
+void circular_buffer<T>::clear() {
+  while (size_ != 0) pop_back();
+  head_ = 0;
+}
+
+template <typename T>
+void circular_buffer<T>::push_back(const_reference value) {
+  if (CheckFull_()) {
+    arr_[head_] = value;
+    head_ = Index_(1);
+  } else {
+    new (arr_ + Index_(size_)) T(value);
+    ++size_;
+  }
+}
+
+template <typename T>
+void circular_buffer<T>::push_back(value_type &&value) {
+  if (CheckFull_()) {
+    arr_[head_] = std::move(value);
+    head_ = Index_(1);
+  } else {
+    new (arr_ + Index_(size_)) T(std::move(value));
+    ++size_;
+  }
+}
+
+template <typename T>
+void circular_buffer<T>::pop_front() {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  arr_[head_].~T();
+  head_ = Index_(1);
+  --size_;
+}
+
+template <typename T>
+void circular_buffer<T>::pop_back() {
+  if (size_ == 0) throw std::out_of_range("Circular buffer is empty");
+  arr_[Index_(size_ - 1)].~T();
+  --size_;
+}
+
+template <typename T>
+void circular_buffer<T>::swap(circular_buffer &other) {
+  std::swap(arr_, other.arr_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+  std::swap(policy_, other.policy_);
+}
+
+template <typename T>
+std::pair<typename circular_buffer<T>::pointer,
+          typename circular_buffer<T>::size_type>
+circular_buffer<T>::array_one() {
+  size_type first = capacity_ - head_ < size_ ? capacity_ - head_ : size_;
+  return {arr_ + head_, first};
+}
+
+template <typename T>
+std::pair<typename circular_buffer<T>::pointer,
+          typename circular_buffer<T>::size_type>
+circular_buffer<T>::array_two() {
+  size_type first = array_one().second;
+  return {arr_, size_ - first};
+}
+
+template <typename T>
+std::pair<typename circular_buffer<T>::const_pointer,
+          typename circular_buffer<T>::size_type>
+circular_buffer<T>::array_one() const {
+  return const_cast<circular_buffer *>(this)->array_one();
+}
+
+template <typename T>
+std::pair<typename circular_buffer<T>::const_pointer,
+          typename circular_buffer<T>::size_type>
+circular_buffer<T>::array_two() const {
+  return const_cast<circular_buffer *>(this)->array_two();
+}
+
+// A full buffer either rejects the push or lets it overwrite the oldest
+// element in place; returns true in the latter case.
+template <typename T>
+bool circular_buffer<T>::CheckFull_() const {
+  if (size_ != capacity_) return false;
+  if (policy_ == overflow_policy::reject || capacity_ == 0)
+    throw std::length_error("Circular buffer is full");
+  return true;
+}
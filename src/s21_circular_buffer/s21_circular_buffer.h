@@ -0,0 +1,154 @@
+#ifndef S21_CIRCULAR_BUFFER_H_
+#define S21_CIRCULAR_BUFFER_H_
+
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// What push_back does when the buffer is full.
+enum class overflow_policy { overwrite, reject };
+
+// Fixed-capacity ring over one contiguous allocation. With the overwrite
+// policy a full buffer drops its oldest element on push_back, which makes
+// it a rolling "last N" window that never allocates after construction.
+template <typename T>
+class circular_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using pointer = T *;
+  using const_pointer = const T *;
+  using size_type = size_t;
+
+  circular_buffer();
+  explicit circular_buffer(
+      size_type capacity, overflow_policy policy = overflow_policy::overwrite);
+  circular_buffer(std::initializer_list<value_type> const &items);
+  circular_buffer(const circular_buffer &other);
+  circular_buffer(circular_buffer &&other);
+  ~circular_buffer();
+
+  circular_buffer &operator=(const circular_buffer &other);
+  circular_buffer &operator=(circular_buffer &&other);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return arr_[Index_(pos)]; }
+  const_reference operator[](size_type pos) const {
+    return arr_[Index_(pos)];
+  }
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  bool empty() const { return size_ == 0; }
+  bool full() const { return size_ == capacity_; }
+  size_type size() const { return size_; }
+  size_type capacity() const { return capacity_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+  overflow_policy policy() const { return policy_; }
+
+  // Changes the capacity, keeping the newest elements that still fit.
+  void set_capacity(size_type capacity);
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_front();
+  void pop_back();
+  void swap(circular_buffer &other);
+
+  // The elements in order are array_one() followed by array_two(); each is
+  // a contiguous run, so the window can be copied out with two memcpy-like
+  // calls.
+  std::pair<pointer, size_type> array_one();
+  std::pair<pointer, size_type> array_two();
+  std::pair<const_pointer, size_type> array_one() const;
+  std::pair<const_pointer, size_type> array_two() const;
+
+ private:
+  T *arr_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+  overflow_policy policy_;
+
+  size_type Index_(size_type pos) const {
+    size_type idx = head_ + pos;
+    return idx >= capacity_ ? idx - capacity_ : idx;
+  }
+  bool CheckFull_() const;
+
+  template <typename BufferT, typename Ref>
+  class IteratorBase_ {
+   public:
+    IteratorBase_() : owner_(nullptr), pos_(0) {}
+    IteratorBase_(BufferT *owner, size_type pos) : owner_(owner), pos_(pos) {}
+
+    Ref operator*() const { return (*owner_)[pos_]; }
+    auto operator->() const { return &(*owner_)[pos_]; }
+    Ref operator[](size_type n) const { return (*owner_)[pos_ + n]; }
+
+    IteratorBase_ &operator++() {
+      ++pos_;
+      return *this;
+    }
+    IteratorBase_ operator++(int) {
+      IteratorBase_ tmp(*this);
+      ++pos_;
+      return tmp;
+    }
+    IteratorBase_ &operator--() {
+      --pos_;
+      return *this;
+    }
+    IteratorBase_ operator--(int) {
+      IteratorBase_ tmp(*this);
+      --pos_;
+      return tmp;
+    }
+    IteratorBase_ operator+(size_type n) const {
+      return IteratorBase_(owner_, pos_ + n);
+    }
+    IteratorBase_ operator-(size_type n) const {
+      return IteratorBase_(owner_, pos_ - n);
+    }
+    long operator-(const IteratorBase_ &other) const {
+      return static_cast<long>(pos_) - static_cast<long>(other.pos_);
+    }
+
+    bool operator==(const IteratorBase_ &other) const {
+      return owner_ == other.owner_ && pos_ == other.pos_;
+    }
+    bool operator!=(const IteratorBase_ &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    BufferT *owner_;
+    size_type pos_;
+  };
+
+ public:
+  using iterator = IteratorBase_<circular_buffer, reference>;
+  using const_iterator = IteratorBase_<const circular_buffer, const_reference>;
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+};
+}  // namespace s21
+
+#include "s21_circular_buffer.cpp"
+
+#endif
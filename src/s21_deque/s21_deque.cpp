@@ -0,0 +1,227 @@
+#include "s21_deque.h"
+
+using namespace s21;
+
+template <typename T>
+deque<T>::deque()
+    : map_(nullptr), map_size_(0), start_(0), size_(0), spare_(nullptr) {}
+
+template <typename T>
+deque<T>::deque(size_type n) : deque() {
+  while (n-- > 0) push_back(T());
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<value_type> const &items) : deque() {
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T>
+deque<T>::deque(const deque &other) : deque() {
+  for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+}
+
+template <typename T>
+deque<T>::deque(deque &&other) : deque() {
+  swap(other);
+}
+
+template <typename T>
+deque<T>::~deque() {
+  clear();
+  shrink_to_fit();
+  delete[] map_;
+}
+
+template <typename T>
+deque<T> &deque<T>::operator=(const deque &other) {
+  if (this != &other) {
+    deque tmp(other);
+    swap(tmp);
+  }
+  return *this;
+}
+
+template <typename T>
+deque<T> &deque<T>::operator=(deque &&other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Element_(pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index out of range");
+  return *Element_(pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::front() {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  return *Element_(0);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::front() const {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  return *Element_(0);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::back() {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  return *Element_(size_ - 1);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::back() const {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  return *Element_(size_ - 1);
+}
+
+template <typename T>
+void deque<T>::clear() {
+  while (size_ != 0) pop_back();
+}
+
+template <typename T>
+void deque<T>::push_back(const_reference value) {
+  new (PrepareBack_()) T(value);
+  ++size_;
+}
+
+template <typename T>
+void deque<T>::push_back(value_type &&value) {
+  new (PrepareBack_()) T(std::move(value));
+  ++size_;
+}
+
+template <typename T>
+void deque<T>::push_front(const_reference value) {
+  new (PrepareFront_()) T(value);
+  --start_;
+  ++size_;
+}
+
+template <typename T>
+void deque<T>::push_front(value_type &&value) {
+  new (PrepareFront_()) T(std::move(value));
+  --start_;
+  ++size_;
+}
+
+template <typename T>
+void deque<T>::pop_back() {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  Element_(size_ - 1)->~T();
+  --size_;
+  if ((start_ + size_) % kBlockSize_ == 0)
+    ReleaseBlock_((start_ + size_) / kBlockSize_);
+  AfterPop_();
+}
+
+template <typename T>
+void deque<T>::pop_front() {
+  if (size_ == 0) throw std::out_of_range("Deque is empty");
+  Element_(0)->~T();
+  ++start_;
+  --size_;
+  if (start_ % kBlockSize_ == 0) ReleaseBlock_(start_ / kBlockSize_ - 1);
+  AfterPop_();
+}
+
+template <typename T>
+void deque<T>::swap(deque &other) {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+template <typename T>
+void deque<T>::shrink_to_fit() {
+  ::operator delete(spare_);
+  spare_ = nullptr;
+}
+
+template <typename T>
+T *deque<T>::NewBlock_() {
+  if (spare_) return std::exchange(spare_, nullptr);
+  return static_cast<T *>(::operator new(kBlockSize_ * sizeof(T)));
+}
+
+template <typename T>
+void deque<T>::ReleaseBlock_(size_type block) {
+  if (!map_[block]) return;
+  if (!spare_)
+    spare_ = map_[block];
+  else
+    ::operator delete(map_[block]);
+  map_[block] = nullptr;
+}
+
+// Makes room for one more block at the requested end, either by sliding
+// the used blocks to the middle of the current map or by doubling it.
+template <typename T>
+void deque<T>::ReallocateMap_(bool at_front) {
+  size_type first = start_ / kBlockSize_;
+  size_type used =
+      size_ == 0 ? 0 : (start_ + size_ - 1) / kBlockSize_ - first + 1;
+  size_type new_first;
+  if (map_size_ >= 2 * (used + 1)) {
+    new_first = (map_size_ - used) / 2 + (at_front ? 1 : 0);
+    if (used != 0)
+      std::memmove(map_ + new_first, map_ + first, used * sizeof(T *));
+    for (size_type i = 0; i < map_size_; ++i)
+      if (i < new_first || i >= new_first + used) map_[i] = nullptr;
+  } else {
+    size_type new_size = map_size_ < kMinMap_ ? kMinMap_ : map_size_ * 2;
+    T **new_map = new T *[new_size]();
+    new_first = (new_size - used) / 2 + (at_front ? 1 : 0);
+    if (used != 0)
+      std::memcpy(new_map + new_first, map_ + first, used * sizeof(T *));
+    delete[] map_;
+    map_ = new_map;
+    map_size_ = new_size;
+  }
+  start_ = new_first * kBlockSize_ + start_ % kBlockSize_;
+}
+
+template <typename T>
+T *deque<T>::PrepareBack_() {
+  size_type idx = start_ + size_;
+  if (idx / kBlockSize_ >= map_size_) {
+    ReallocateMap_(false);
+    idx = start_ + size_;
+  }
+  size_type block = idx / kBlockSize_;
+  if (!map_[block]) map_[block] = NewBlock_();
+  return map_[block] + idx % kBlockSize_;
+}
+
+template <typename T>
+T *deque<T>::PrepareFront_() {
+  if (start_ == 0) ReallocateMap_(true);
+  size_type idx = start_ - 1;
+  size_type block = idx / kBlockSize_;
+  if (!map_[block]) map_[block] = NewBlock_();
+  return map_[block] + idx % kBlockSize_;
+}
+
+// An empty deque keeps no blocks in the map and restarts from its middle,
+// so that both ends have room again.
+template <typename T>
+void deque<T>::AfterPop_() {
+  if (size_ != 0) return;
+  if (start_ / kBlockSize_ < map_size_) ReleaseBlock_(start_ / kBlockSize_);
+  start_ = map_size_ / 2 * kBlockSize_;
+}
@@ -0,0 +1,150 @@
+#ifndef S21_DEQUE_H_
+#define S21_DEQUE_H_
+
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Double-ended queue over fixed-size blocks. A block map holds the blocks
+// in order, so pushing or popping at either end is O(1) and never moves
+// existing elements. One emptied block is kept as a spare, which means a
+// queue that pushes at the back and pops at the front stops allocating once
+// it has reached its working size.
+template <typename T>
+class deque {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  deque();
+  explicit deque(size_type n);
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &other);
+  deque(deque &&other);
+  ~deque();
+
+  deque &operator=(const deque &other);
+  deque &operator=(deque &&other);
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos) { return *Element_(pos); }
+  const_reference operator[](size_type pos) const { return *Element_(pos); }
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+  size_type max_size() const {
+    return std::numeric_limits<size_type>::max() / sizeof(value_type) / 2;
+  }
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  void pop_back();
+  void pop_front();
+  void swap(deque &other);
+  // Frees the spare block kept for reuse.
+  void shrink_to_fit();
+
+ private:
+  static constexpr size_type kBlockBytes_ = 512;
+  static constexpr size_type kBlockSize_ =
+      sizeof(T) * 16 > kBlockBytes_ ? 16 : kBlockBytes_ / sizeof(T);
+  static constexpr size_type kMinMap_ = 8;
+
+  T **map_;
+  size_type map_size_;
+  // Position of front() counted from the first slot of map_[0].
+  size_type start_;
+  size_type size_;
+  T *spare_;
+
+  T *Element_(size_type pos) const {
+    size_type idx = start_ + pos;
+    return map_[idx / kBlockSize_] + idx % kBlockSize_;
+  }
+  T *NewBlock_();
+  void ReleaseBlock_(size_type block);
+  void ReallocateMap_(bool at_front);
+  T *PrepareBack_();
+  T *PrepareFront_();
+  void AfterPop_();
+
+  template <typename DequeT, typename Ref>
+  class IteratorBase_ {
+   public:
+    IteratorBase_() : owner_(nullptr), pos_(0) {}
+    IteratorBase_(DequeT *owner, size_type pos) : owner_(owner), pos_(pos) {}
+
+    Ref operator*() const { return (*owner_)[pos_]; }
+    auto operator->() const { return &(*owner_)[pos_]; }
+    Ref operator[](size_type n) const { return (*owner_)[pos_ + n]; }
+
+    IteratorBase_ &operator++() {
+      ++pos_;
+      return *this;
+    }
+    IteratorBase_ operator++(int) {
+      IteratorBase_ tmp(*this);
+      ++pos_;
+      return tmp;
+    }
+    IteratorBase_ &operator--() {
+      --pos_;
+      return *this;
+    }
+    IteratorBase_ operator--(int) {
+      IteratorBase_ tmp(*this);
+      --pos_;
+      return tmp;
+    }
+    IteratorBase_ operator+(size_type n) const {
+      return IteratorBase_(owner_, pos_ + n);
+    }
+    IteratorBase_ operator-(size_type n) const {
+      return IteratorBase_(owner_, pos_ - n);
+    }
+    long operator-(const IteratorBase_ &other) const {
+      return static_cast<long>(pos_) - static_cast<long>(other.pos_);
+    }
+
+    bool operator==(const IteratorBase_ &other) const {
+      return owner_ == other.owner_ && pos_ == other.pos_;
+    }
+    bool operator!=(const IteratorBase_ &other) const {
+      return !(*this == other);
+    }
+
+   private:
+    DequeT *owner_;
+    size_type pos_;
+  };
+
+ public:
+  using iterator = IteratorBase_<deque, reference>;
+  using const_iterator = IteratorBase_<const deque, const_reference>;
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, size_); }
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, size_); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+};
+}  // namespace s21
+
+#include "s21_deque.cpp"
+
+#endif
@@ -0,0 +1,267 @@
+#ifndef S21_EXECUTOR_H_
+#define S21_EXECUTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../s21_lockfree_queue/s21_lockfree_queue.h"
+#include "../s21_work_stealing_deque/s21_work_stealing_deque.h"
+
+namespace s21 {
+class task_group;
+
+// Work-stealing thread pool. Each worker owns a work_stealing_deque: tasks
+// it spawns go to its own bottom and are run newest first, which keeps a
+// divide-and-conquer job depth first and cache warm, while idle workers
+// steal the oldest (largest) pieces from the top of a victim's deque.
+// Tasks spawned from outside the pool enter through a shared lock-free
+// queue. Work is submitted through a task_group.
+class executor {
+ public:
+  using size_type = size_t;
+
+  explicit executor(size_type threads = DefaultThreads_());
+  executor(const executor &) = delete;
+  executor &operator=(const executor &) = delete;
+  // Every task_group must have been waited for.
+  ~executor();
+
+  size_type size() const { return count_; }
+
+ private:
+  friend class task_group;
+
+  struct Task_ {
+    std::function<void()> fn_;
+    task_group *group_;
+  };
+
+  struct Worker_ {
+    work_stealing_deque<Task_ *> tasks_;
+    std::thread thread_;
+  };
+
+  // Which pool, if any, the calling thread works for.
+  struct Membership_ {
+    executor *owner_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  static constexpr int kSpins_ = 64;
+
+  size_type count_;
+  std::unique_ptr<Worker_[]> workers_;
+  lockfree_queue<Task_ *> injected_;
+  std::atomic<bool> stop_;
+  // Bumped on every spawn; a worker only sleeps while it is unchanged
+  // since its last unsuccessful search.
+  std::atomic<uint64_t> epoch_;
+  std::atomic<size_type> sleepers_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+
+  static size_type DefaultThreads_() {
+    return std::max(1U, std::thread::hardware_concurrency());
+  }
+  static Membership_ &Current_() {
+    static thread_local Membership_ current;
+    return current;
+  }
+  Worker_ *Self_() {
+    Membership_ &current = Current_();
+    return current.owner_ == this ? &workers_[current.index_] : nullptr;
+  }
+
+  void Submit_(Task_ *task);
+  bool FindTask_(Task_ *&task);
+  void Run_(Task_ *task);
+  void WorkerLoop_(size_type index);
+};
+
+// A set of tasks that can be waited for together. Tasks may spawn more
+// tasks into the same group. wait() does not block a worker: the waiting
+// thread runs pending tasks until the group is done, so nested groups do
+// not deadlock the pool.
+class task_group {
+ public:
+  using size_type = executor::size_type;
+
+  explicit task_group(executor &ex) : ex_(ex), pending_(0) {}
+  task_group(const task_group &) = delete;
+  task_group &operator=(const task_group &) = delete;
+  ~task_group() { Help_(); }
+
+  template <typename Fn>
+  void spawn(Fn &&fn) {
+    auto *task = new executor::Task_{std::forward<Fn>(fn), this};
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    ex_.Submit_(task);
+  }
+  // Returns once every spawned task has finished and rethrows the first
+  // exception one of them threw.
+  void wait();
+
+ private:
+  friend class executor;
+
+  executor &ex_;
+  std::atomic<size_type> pending_;
+  std::mutex error_mutex_;
+  std::exception_ptr error_;
+
+  void Help_();
+  void Fail_(std::exception_ptr error) {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    if (!error_) error_ = error;
+  }
+};
+
+// Calls fn(i) for every i in [begin, end) on the pool and returns when all
+// calls are done. The range is halved recursively down to `grain`
+// indices, so idle workers steal large halves first.
+template <typename Fn>
+void parallel_for(executor &ex, size_t begin, size_t end, Fn &&fn,
+                  size_t grain = 1);
+
+inline executor::executor(size_type threads)
+    : count_(threads),
+      workers_(new Worker_[threads]),
+      stop_(false),
+      epoch_(0),
+      sleepers_(0) {
+  for (size_type i = 0; i < count_; ++i)
+    workers_[i].thread_ = std::thread(&executor::WorkerLoop_, this, i);
+}
+
+inline executor::~executor() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_.store(true);
+  }
+  wake_.notify_all();
+  for (size_type i = 0; i < count_; ++i) workers_[i].thread_.join();
+}
+
+inline void executor::Submit_(Task_ *task) {
+  Worker_ *self = Self_();
+  if (self != nullptr)
+    self->tasks_.push(task);
+  else
+    injected_.push(task);
+  epoch_.fetch_add(1);
+  if (sleepers_.load() != 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    wake_.notify_one();
+  }
+}
+
+// Own deque first, then the shared queue, then the other workers starting
+// after ourselves, so thieves spread over different victims.
+inline bool executor::FindTask_(Task_ *&task) {
+  Worker_ *self = Self_();
+  if (self != nullptr && self->tasks_.try_pop(task)) return true;
+  if (injected_.try_pop(task)) return true;
+  size_type start = self != nullptr ? Current_().index_ + 1 : 0;
+  for (size_type i = 0; i < count_; ++i) {
+    Worker_ &victim = workers_[(start + i) % count_];
+    if (&victim != self && victim.tasks_.try_steal(task)) return true;
+  }
+  return false;
+}
+
+inline void executor::Run_(Task_ *task) {
+  task_group *group = task->group_;
+  try {
+    task->fn_();
+  } catch (...) {
+    group->Fail_(std::current_exception());
+  }
+  delete task;
+  // The group may be destroyed as soon as this drops to zero.
+  group->pending_.fetch_sub(1, std::memory_order_release);
+}
+
+inline void executor::WorkerLoop_(size_type index) {
+  Current_() = Membership_{this, index};
+  Task_ *task = nullptr;
+  while (!stop_.load(std::memory_order_relaxed)) {
+    bool found = false;
+    for (int spin = 0; spin < kSpins_ && !found; ++spin) {
+      found = FindTask_(task);
+      if (!found) std::this_thread::yield();
+    }
+    if (found) {
+      Run_(task);
+      continue;
+    }
+    // Announce the nap before the last look, so a concurrent Submit_
+    // either sees us sleeping or its task is found by the look.
+    sleepers_.fetch_add(1);
+    uint64_t epoch = epoch_.load();
+    if (FindTask_(task)) {
+      sleepers_.fetch_sub(1);
+      Run_(task);
+      continue;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    wake_.wait(lock, [&] {
+      return stop_.load(std::memory_order_relaxed) || epoch_.load() != epoch;
+    });
+    sleepers_.fetch_sub(1);
+  }
+  Current_() = Membership_{};
+}
+
+inline void task_group::Help_() {
+  executor::Task_ *task = nullptr;
+  while (pending_.load(std::memory_order_acquire) != 0) {
+    if (ex_.FindTask_(task))
+      ex_.Run_(task);
+    else
+      std::this_thread::yield();
+  }
+}
+
+inline void task_group::wait() {
+  Help_();
+  std::exception_ptr error;
+  {
+    std::lock_guard<std::mutex> lock(error_mutex_);
+    std::swap(error, error_);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+namespace parallel_detail {
+template <typename Fn>
+void Split(task_group &group, size_t begin, size_t end, size_t grain,
+           Fn &fn) {
+  while (end - begin > grain) {
+    size_t mid = begin + (end - begin) / 2;
+    group.spawn([&group, mid, end, grain, &fn] {
+      Split(group, mid, end, grain, fn);
+    });
+    end = mid;
+  }
+  for (size_t i = begin; i < end; ++i) fn(i);
+}
+}  // namespace parallel_detail
+
+template <typename Fn>
+void parallel_for(executor &ex, size_t begin, size_t end, Fn &&fn,
+                  size_t grain) {
+  if (begin >= end) return;
+  task_group group(ex);
+  parallel_detail::Split(group, begin, end, std::max<size_t>(grain, 1), fn);
+  group.wait();
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,296 @@
+#ifndef S21_INTRUSIVE_LIST_H_
+#define S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Links of an intrusive list live inside the user object. A hook is either
+// safe (the owner must erase the object before destroying it) or auto-unlink
+// (the hook removes itself from whatever list it is on when destroyed).
+enum class link_mode { safe, auto_unlink };
+
+template <link_mode Mode = link_mode::safe>
+class list_hook {
+ public:
+  list_hook() : ptr_next_(nullptr), ptr_prev_(nullptr), owner_(nullptr) {}
+  // Copying an object must not copy its list membership.
+  list_hook(const list_hook &)
+      : ptr_next_(nullptr), ptr_prev_(nullptr), owner_(nullptr) {}
+  list_hook &operator=(const list_hook &) { return *this; }
+  ~list_hook() {
+    if (Mode == link_mode::auto_unlink) Unlink_();
+  }
+
+  bool is_linked() const { return ptr_next_ != nullptr; }
+
+  // O(1) removal from any list. Only auto-unlink hooks may do this on their
+  // own, because a safe-mode list keeps its size in a counter.
+  void unlink() {
+    static_assert(Mode == link_mode::auto_unlink,
+                  "use intrusive_list::erase to unlink a safe hook");
+    Unlink_();
+  }
+
+ private:
+  template <typename T, typename HookT, HookT T::*Member>
+  friend class intrusive_list;
+
+  list_hook *ptr_next_;
+  list_hook *ptr_prev_;
+  // The object holding the hook, set when it is linked. Working back from
+  // the member offset would need T to be standard-layout.
+  void *owner_;
+
+  void Unlink_() {
+    if (!ptr_next_) return;
+    ptr_prev_->ptr_next_ = ptr_next_;
+    ptr_next_->ptr_prev_ = ptr_prev_;
+    ptr_next_ = nullptr;
+    ptr_prev_ = nullptr;
+  }
+};
+
+using auto_unlink_hook = list_hook<link_mode::auto_unlink>;
+
+// Doubly linked list of existing objects. Linking and unlinking never
+// allocate: the list only rewires the hook selected by Member, so one object
+// can sit on several lists at once through several hooks.
+template <typename T, typename HookT, HookT T::*Member>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  intrusive_list() : size_(0) { Initvirtual_(); }
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&other) : size_(0) {
+    Initvirtual_();
+    swap(other);
+  }
+  ~intrusive_list() { clear(); }
+
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&other) {
+    if (this != &other) {
+      clear();
+      swap(other);
+    }
+    return *this;
+  }
+
+ private:
+  static constexpr bool kAutoUnlink =
+      std::is_same<HookT, list_hook<link_mode::auto_unlink>>::value;
+
+  // The sentinel closes the ring, like virtual_ in s21::list.
+  HookT virtual_;
+  size_type size_;
+
+  void Initvirtual_() { InitRing_(virtual_); }
+
+  static void InitRing_(HookT &sentinel) {
+    sentinel.ptr_next_ = &sentinel;
+    sentinel.ptr_prev_ = &sentinel;
+  }
+
+  // Re-homes the ring closed by from onto the sentinel to.
+  static void MoveRing_(HookT &from, HookT &to) {
+    if (from.ptr_next_ == &from) {
+      InitRing_(to);
+      return;
+    }
+    to.ptr_next_ = from.ptr_next_;
+    to.ptr_prev_ = from.ptr_prev_;
+    to.ptr_next_->ptr_prev_ = &to;
+    to.ptr_prev_->ptr_next_ = &to;
+    InitRing_(from);
+  }
+
+  static HookT *ToHook_(T &value) { return &(value.*Member); }
+
+  static T *ToValue_(HookT *hook) { return static_cast<T *>(hook->owner_); }
+
+  static void LinkBefore_(HookT *pos, HookT *hook) {
+    if (hook->is_linked()) throw std::logic_error("Hook is already linked");
+    hook->ptr_next_ = pos;
+    hook->ptr_prev_ = pos->ptr_prev_;
+    pos->ptr_prev_->ptr_next_ = hook;
+    pos->ptr_prev_ = hook;
+  }
+
+  class const_iterator {
+   public:
+    const_iterator() : ptr_(nullptr) {}
+    explicit const_iterator(const HookT *hook)
+        : ptr_(const_cast<HookT *>(hook)) {}
+
+    bool operator==(const const_iterator &other) const {
+      return ptr_ == other.ptr_;
+    }
+    bool operator!=(const const_iterator &other) const {
+      return ptr_ != other.ptr_;
+    }
+
+    const_reference operator*() const { return *ToValue_(ptr_); }
+    const T *operator->() const { return ToValue_(ptr_); }
+
+    const_iterator &operator++() {
+      ptr_ = ptr_->ptr_next_;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    const_iterator &operator--() {
+      ptr_ = ptr_->ptr_prev_;
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+
+    HookT *GetHook_() const { return ptr_; }
+
+   protected:
+    HookT *ptr_;
+  };
+
+  class iterator : public const_iterator {
+   public:
+    iterator() : const_iterator() {}
+    explicit iterator(HookT *hook) : const_iterator(hook) {}
+
+    reference operator*() const { return *ToValue_(this->ptr_); }
+    T *operator->() const { return ToValue_(this->ptr_); }
+
+    iterator &operator++() {
+      const_iterator::operator++();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator tmp(*this);
+      ++*this;
+      return tmp;
+    }
+    iterator &operator--() {
+      const_iterator::operator--();
+      return *this;
+    }
+    iterator operator--(int) {
+      iterator tmp(*this);
+      --*this;
+      return tmp;
+    }
+  };
+
+ public:
+  iterator begin() { return iterator(virtual_.ptr_next_); }
+  iterator end() { return iterator(&virtual_); }
+  const_iterator begin() const { return const_iterator(virtual_.ptr_next_); }
+  const_iterator end() const { return const_iterator(&virtual_); }
+
+  // Iterator to an object that is known to be on this list, in O(1).
+  iterator iterator_to(reference value) { return iterator(ToHook_(value)); }
+
+  bool empty() const { return virtual_.ptr_next_ == &virtual_; }
+
+  // Auto-unlink hooks can leave the list behind its back, so the size of
+  // such a list is counted on demand.
+  size_type size() const {
+    if (!kAutoUnlink) return size_;
+    size_type n = 0;
+    for (auto it = begin(); it != end(); ++it) ++n;
+    return n;
+  }
+
+  reference front() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *begin();
+  }
+  reference back() {
+    if (empty()) throw std::out_of_range("List is empty");
+    return *--end();
+  }
+
+  void push_front(reference value) { insert(begin(), value); }
+  void push_back(reference value) { insert(end(), value); }
+
+  void pop_front() {
+    if (!empty()) erase(begin());
+  }
+  void pop_back() {
+    if (!empty()) erase(--end());
+  }
+
+  iterator insert(const_iterator pos, reference value) {
+    HookT *hook = ToHook_(value);
+    LinkBefore_(pos.GetHook_(), hook);
+    hook->owner_ = &value;
+    ++size_;
+    return iterator(hook);
+  }
+
+  // Unlinks the element at pos and returns the one after it.
+  iterator erase(const_iterator pos) {
+    HookT *hook = pos.GetHook_();
+    if (hook == &virtual_) return end();
+    HookT *next = hook->ptr_next_;
+    hook->Unlink_();
+    --size_;
+    return iterator(next);
+  }
+
+  // O(1) removal of an object known to be on this list.
+  void erase(reference value) { erase(iterator_to(value)); }
+
+  // Moves all elements of other before pos without touching the objects.
+  void splice(const_iterator pos, intrusive_list &other) {
+    if (this == &other || other.empty()) return;
+    HookT *first = other.virtual_.ptr_next_;
+    HookT *last = other.virtual_.ptr_prev_;
+    HookT *cur = pos.GetHook_();
+    first->ptr_prev_ = cur->ptr_prev_;
+    cur->ptr_prev_->ptr_next_ = first;
+    last->ptr_next_ = cur;
+    cur->ptr_prev_ = last;
+    size_ += other.size_;
+    other.Initvirtual_();
+    other.size_ = 0;
+  }
+
+  void swap(intrusive_list &other) {
+    if (this == &other) return;
+    HookT tmp;
+    MoveRing_(virtual_, tmp);
+    MoveRing_(other.virtual_, virtual_);
+    MoveRing_(tmp, other.virtual_);
+    std::swap(size_, other.size_);
+  }
+
+  // Unlinks every element; the objects themselves are left untouched.
+  void clear() {
+    HookT *cur = virtual_.ptr_next_;
+    while (cur != &virtual_) {
+      HookT *next = cur->ptr_next_;
+      cur->ptr_next_ = nullptr;
+      cur->ptr_prev_ = nullptr;
+      cur = next;
+    }
+    Initvirtual_();
+    size_ = 0;
+  }
+};
+
+}  // namespace s21
+
+#endif
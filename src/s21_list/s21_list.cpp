@@ -3,30 +3,64 @@
 using namespace s21;
 
 template <typename T>
-list<T>::list() : head_(nullptr), tail_(nullptr), size_(0) {
+list<T>::list()
+    : head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      blocks_(nullptr),
+      free_(nullptr),
+      free_count_(0) {
   Initvirtual_();
 }
 
 template <typename T>
-list<T>::list(list::size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
+list<T>::list(list::size_type n)
+    : head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      blocks_(nullptr),
+      free_(nullptr),
+      free_count_(0) {
   if (n <= 0) throw std::out_of_range("Index out of range");
   Initvirtual_();
+  ReserveNodes_(n);
   while (n-- > 0) push_back(T());
 }
 
 template <typename T>
 list<T>::list(std::initializer_list<value_type> const &items)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+    : head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      blocks_(nullptr),
+      free_(nullptr),
+      free_count_(0) {
   Initvirtual_();
-  for (value_type i : items) {
-    push_back(i);
+  try {
+    LinkRange_(virtual_, items.begin(), items.end(), items.size());
+  } catch (...) {
+    clear();
+    delete virtual_;
+    throw;
   }
 }
 
 template <typename T>
-list<T>::list(const list &other) : head_(nullptr), tail_(nullptr), size_(0) {
+list<T>::list(const list &other)
+    : head_(nullptr),
+      tail_(nullptr),
+      size_(0),
+      blocks_(nullptr),
+      free_(nullptr),
+      free_count_(0) {
   Initvirtual_();
-  *this = other;
+  try {
+    *this = other;
+  } catch (...) {
+    clear();
+    delete virtual_;
+    throw;
+  }
 }
 
 template <typename T>
@@ -36,10 +70,16 @@ list<T>::list(list &&other) {
     tail_ = other.tail_;
     size_ = other.size_;
     virtual_ = other.virtual_;
+    blocks_ = other.blocks_;
+    free_ = other.free_;
+    free_count_ = other.free_count_;
     other.size_ = 0;
     other.head_ = nullptr;
     other.tail_ = nullptr;
     other.virtual_ = nullptr;
+    other.blocks_ = nullptr;
+    other.free_ = nullptr;
+    other.free_count_ = 0;
     other.Initvirtual_();
   }
 }
@@ -52,7 +92,7 @@ list<T>::~list() {
 
 template <typename T>
 void list<T>::push_front(const_reference data) {
-  auto *new_ptr = new Node_(data);
+  Node_ *new_ptr = NewNode_(data);
   if (!head_) {
     head_ = new_ptr;
     head_->ptr_prev_ = virtual_;
@@ -79,7 +119,7 @@ void list<T>::push_front(const_reference data) {
 
 template <typename T>
 void list<T>::push_back(const_reference data) {
-  auto *new_ptr = new Node_(data);
+  Node_ *new_ptr = NewNode_(data);
   if (!head_) {
     head_ = new_ptr;
     head_->ptr_next_ = virtual_;
@@ -113,7 +153,7 @@ void list<T>::pop_front() {
       head_ = nullptr;
     }
 
-    if (head_rm->ptr_next_) delete head_rm;
+    if (head_rm->ptr_next_) DeleteNode_(head_rm);
 
     if (size_ == 2) {
       head_ = tail_;
@@ -138,7 +178,7 @@ void list<T>::pop_back() {
       tail_ = nullptr;
     }
 
-    if (tail_rm->ptr_prev_) delete tail_rm;
+    if (tail_rm->ptr_prev_) DeleteNode_(tail_rm);
 
     if (size_ == 2) {
       virtual_->ptr_next_ = head_;
@@ -180,6 +220,9 @@ void list<T>::swap(list &other) {
   other.virtual_ = tmp_virtual;
   other.size_ = size_;
   size_ = tmp_size;
+  std::swap(blocks_, other.blocks_);
+  std::swap(free_, other.free_);
+  std::swap(free_count_, other.free_count_);
 }
 
 template <typename T>
@@ -268,36 +311,45 @@ bool list<T>::empty() const {
 
 template <typename T>
 void list<T>::clear() {
+  Node_ *node = head_;
   while (size_ != 0) {
-    pop_front();
+    Node_ *next = node->ptr_next_;
+    node->~Node_();
+    node = next;
+    --size_;
   }
+  head_ = nullptr;
+  tail_ = nullptr;
+  if (virtual_) {
+    virtual_->ptr_next_ = nullptr;
+    virtual_->ptr_prev_ = nullptr;
+    virtual_->value_ = size_;
+  }
+  ReleaseBlocks_();
 }
 
 template <typename T>
 typename list<T>::iterator list<T>::insert(list::iterator pos,
                                            const_reference value) {
   Node_ *cur_node = GetiteratorNode_(pos);
-  auto *new_node_ = new Node_(value);
   if (size_ <= 1) {
     if (cur_node == virtual_)
       push_back(value);
     else if (cur_node == head_)
       push_front(value);
-    delete new_node_;
-    new_node_ = nullptr;
     return iterator(head_);
-  } else {
-    Node_ *prev_node = cur_node->ptr_prev_;
-    new_node_->ptr_prev_ = prev_node;
-    new_node_->ptr_next_ = cur_node;
-    cur_node->ptr_prev_ = new_node_;
-    prev_node->ptr_next_ = new_node_;
-    if (cur_node == virtual_)
-      tail_ = new_node_;
-    else if (cur_node == head_)
-      head_ = new_node_;
-    ++size_;
   }
+  Node_ *new_node_ = NewNode_(value);
+  Node_ *prev_node = cur_node->ptr_prev_;
+  new_node_->ptr_prev_ = prev_node;
+  new_node_->ptr_next_ = cur_node;
+  cur_node->ptr_prev_ = new_node_;
+  prev_node->ptr_next_ = new_node_;
+  if (cur_node == virtual_)
+    tail_ = new_node_;
+  else if (cur_node == head_)
+    head_ = new_node_;
+  ++size_;
   return iterator(new_node_);
 }
 
@@ -314,7 +366,7 @@ void list<T>::erase(list::iterator pos) {
     Node_ *next = ptr->ptr_next_;
     prev->ptr_next_ = next;
     next->ptr_prev_ = prev;
-    delete ptr;
+    DeleteNode_(ptr);
     --size_;
   }
 }
@@ -332,13 +384,7 @@ list<T> &list<T>::operator=(const list<T> &other) {
   if (this != &other) {
     clear();
     if (!virtual_) Initvirtual_();
-    Node_ *tmp_node = other.head_;
-    if (tmp_node) {
-      while (tmp_node != other.virtual_) {
-        push_back(tmp_node->value_);
-        tmp_node = tmp_node->ptr_next_;
-      }
-    }
+    LinkRange_(virtual_, other.begin(), other.end(), other.size_);
   }
   return *this;
 }
@@ -346,8 +392,8 @@ list<T> &list<T>::operator=(const list<T> &other) {
 template <typename T>
 list<T> &list<T>::operator=(list<T> &&other) {
   if (this != &other) {
-    list<T> tmp_lst(std::move(other));
-    *this = tmp_lst;
+    clear();
+    swap(other);
   }
   return *this;
 }
@@ -359,6 +405,97 @@ void list<T>::Initvirtual_() {
   virtual_->ptr_prev_ = nullptr;
 }
 
+template <typename T>
+typename list<T>::Node_ *list<T>::NewNode_(const_reference value) {
+  if (!free_) ReserveNodes_(size_ < kMinBlock_ ? kMinBlock_ : size_);
+  Slot_ *slot = free_;
+  free_ = slot->next_free_;
+  --free_count_;
+  try {
+    return new (&slot->node_) Node_(value);
+  } catch (...) {
+    slot->next_free_ = free_;
+    free_ = slot;
+    ++free_count_;
+    throw;
+  }
+}
+
+template <typename T>
+void list<T>::DeleteNode_(Node_ *node) {
+  node->~Node_();
+  Slot_ *slot = reinterpret_cast<Slot_ *>(node);
+  slot->next_free_ = free_;
+  free_ = slot;
+  ++free_count_;
+}
+
+template <typename T>
+void list<T>::ReserveNodes_(size_type n) {
+  if (free_count_ >= n) return;
+  size_type count = n - free_count_;
+  Slot_ *block = new Slot_[count + 1];
+  block[0].next_free_ = blocks_;
+  blocks_ = block;
+  for (size_type i = count; i > 0; --i) {
+    block[i].next_free_ = free_;
+    free_ = &block[i];
+  }
+  free_count_ += count;
+}
+
+template <typename T>
+void list<T>::ReleaseBlocks_() {
+  while (blocks_) {
+    Slot_ *next = blocks_[0].next_free_;
+    delete[] blocks_;
+    blocks_ = next;
+  }
+  free_ = nullptr;
+  free_count_ = 0;
+}
+
+// The new nodes are chained on the side and only spliced in once every
+// copy has succeeded, so a throwing copy leaves the list as it was.
+template <typename T>
+template <typename InputIt>
+typename list<T>::Node_ *list<T>::LinkRange_(Node_ *pos, InputIt first,
+                                             InputIt last, size_type n) {
+  if (first == last) return pos;
+  ReserveNodes_(n);
+  Node_ *first_new = nullptr;
+  Node_ *last_new = nullptr;
+  size_type count = 0;
+  try {
+    for (; first != last; ++first, ++count) {
+      Node_ *node = NewNode_(*first);
+      node->ptr_prev_ = last_new;
+      if (last_new)
+        last_new->ptr_next_ = node;
+      else
+        first_new = node;
+      last_new = node;
+    }
+  } catch (...) {
+    while (last_new) {
+      Node_ *prev = last_new->ptr_prev_;
+      DeleteNode_(last_new);
+      last_new = prev;
+    }
+    throw;
+  }
+  Node_ *prev = size_ == 0 ? virtual_ : pos->ptr_prev_;
+  first_new->ptr_prev_ = prev;
+  prev->ptr_next_ = first_new;
+  last_new->ptr_next_ = pos;
+  pos->ptr_prev_ = last_new;
+  size_ += count;
+  head_ = virtual_->ptr_next_;
+  tail_ = size_ > 1 ? virtual_->ptr_prev_ : nullptr;
+  virtual_->value_ = size_;
+  return first_new;
+}
+
 template <typename T>
 void list<T>::MergeSort_(list<T> &left, list<T> &right, list<T> &result) {
   list<T> merged;
@@ -2,7 +2,9 @@
 #define S21_LIST
 
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <new>
 
 namespace s21 {
 template <typename T>
@@ -48,16 +50,55 @@ class list {
         : value_(value), ptr_next_(nullptr), ptr_prev_(nullptr) {}
   } Node_;
 
+  // Node storage is carved out of per-list blocks, so copying or assigning
+  // n elements costs one allocation. Freed nodes go back to free_ and are
+  // only returned to the system by clear() or the destructor, which is why
+  // nodes are never relinked into another list: a list that shrinks keeps
+  // the memory of its largest size until then.
+  union Slot_ {
+    Slot_ *next_free_;
+    Node_ node_;
+    Slot_() : next_free_(nullptr) {}
+    ~Slot_() {}
+  };
+
+  static constexpr size_type kMinBlock_ = 16;
+
   Node_ *head_;
   Node_ *tail_;
   Node_ *virtual_;
   size_type size_;
+  Slot_ *blocks_;
+  Slot_ *free_;
+  size_type free_count_;
 
   void Initvirtual_();
+  Node_ *NewNode_(const_reference value);
+  void DeleteNode_(Node_ *node);
+  void ReserveNodes_(size_type n);
+  void ReleaseBlocks_();
+  // Links [first, last) in before pos; n is how many nodes to reserve.
+  template <typename InputIt>
+  Node_ *LinkRange_(Node_ *pos, InputIt first, InputIt last, size_type n);
+  template <typename ForwardIt>
+  static size_type RangeSize_(ForwardIt first, ForwardIt last,
+                              std::forward_iterator_tag) {
+    return std::distance(first, last);
+  }
+  template <typename InputIt>
+  static size_type RangeSize_(InputIt, InputIt, std::input_iterator_tag) {
+    return 0;
+  }
   void MergeSort_(list<T> &left, list<T> &right, list<T> &result);
 
   class const_iterator {
    public:
+    using iterator_category = std::bidirectional_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
     const_iterator() { ptr_ = nullptr; };
     explicit const_iterator(list::Node_ *node) { ptr_ = node; };
     const_iterator(const const_iterator &other) { ptr_ = other.ptr_; };
@@ -126,6 +167,9 @@ class list {
 
   class iterator : public const_iterator {
    public:
+    using pointer = T *;
+    using reference = T &;
+
     iterator() : const_iterator(){};
     explicit iterator(Node_ *node) : const_iterator(node){};
     iterator(const iterator &other) : const_iterator(other){};
@@ -144,6 +188,17 @@ class list {
   iterator end() const { return iterator(virtual_); }
   iterator insert(iterator pos, const_reference value);
 
+  // Inserts [first, last) before pos and returns an iterator to the first
+  // inserted one. A forward range is counted first so all nodes come from
+  // one block; an input range is read once, a block at a time.
+  template <typename InputIt>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type n = RangeSize_(
+        first, last,
+        typename std::iterator_traits<InputIt>::iterator_category());
+    return iterator(LinkRange_(GetiteratorNode_(pos), first, last, n));
+  }
+
   template <typename... Args>
   iterator emplace(const_iterator pos, Args &&...args) {
     Node_ *pos_node = GetiteratorNode_(pos);
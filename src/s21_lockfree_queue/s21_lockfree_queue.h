@@ -0,0 +1,176 @@
+#ifndef S21_LOCKFREE_QUEUE_H_
+#define S21_LOCKFREE_QUEUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "../s21_tagged_pool/s21_tagged_pool.h"
+
+namespace s21 {
+// Unbounded lock-free queue for any number of producers and consumers
+// (Michael and Scott). The list always starts with a dummy node, the role
+// the virtual_ sentinel plays in s21::list: head_ points at it and the
+// front element lives in the node after it. Nodes come from a tagged_pool,
+// so a thread holding a stale index still reads valid memory, and popped
+// nodes are recycled through the pool's free list instead of being freed;
+// once the pool has grown to the queue's high-water mark, push and pop no
+// longer allocate.
+template <typename T>
+class lockfree_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Nodes for `reserve` elements are created up front.
+  explicit lockfree_queue(size_type reserve = 0);
+  lockfree_queue(const lockfree_queue &) = delete;
+  lockfree_queue &operator=(const lockfree_queue &) = delete;
+  ~lockfree_queue();
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args);
+  bool try_pop(reference out);
+
+  // Only a snapshot while other threads are pushing or popping.
+  bool empty() const;
+  // Nodes created so far; stays flat once pushes and pops are balanced.
+  size_type nodes_created() const { return pool_.nodes_created(); }
+
+ private:
+  static constexpr size_type kCacheLine_ = 64;
+
+  struct Node_ {
+    std::atomic<uint64_t> next_{0};
+    // A node holding a value is recycled only after both its value was
+    // taken and it stopped being the dummy, whichever happens last.
+    std::atomic<int> refs_{0};
+    alignas(T) unsigned char storage_[sizeof(T)];
+    T *Value_() { return reinterpret_cast<T *>(storage_); }
+  };
+
+  using pool_type = tagged_pool<Node_>;
+  using index_type = typename pool_type::index_type;
+
+  alignas(kCacheLine_) std::atomic<uint64_t> head_;
+  alignas(kCacheLine_) std::atomic<uint64_t> tail_;
+  alignas(kCacheLine_) pool_type pool_;
+
+  static index_type IndexOf_(uint64_t link) {
+    return pool_type::IndexOf(link);
+  }
+  static uint64_t Retarget_(uint64_t link, index_type index) {
+    return pool_type::Retarget(link, index);
+  }
+  // A fresh node whose next_ is null, keeping the tag sequence going.
+  index_type NewNode_(int refs);
+  void Release_(index_type index) {
+    if (pool_.at(index).refs_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+      pool_.release(index);
+  }
+};
+
+template <typename T>
+lockfree_queue<T>::lockfree_queue(size_type reserve) : pool_(reserve + 1) {
+  index_type dummy = NewNode_(1);
+  head_.store(pool_type::Pack(dummy, 0), std::memory_order_relaxed);
+  tail_.store(pool_type::Pack(dummy, 0), std::memory_order_relaxed);
+}
+
+template <typename T>
+lockfree_queue<T>::~lockfree_queue() {
+  index_type index = IndexOf_(head_.load(std::memory_order_relaxed));
+  for (;;) {
+    index = IndexOf_(pool_.at(index).next_.load(std::memory_order_relaxed));
+    if (index == pool_type::kNull) break;
+    pool_.at(index).Value_()->~T();
+  }
+}
+
+template <typename T>
+template <typename... Args>
+void lockfree_queue<T>::emplace(Args &&...args) {
+  index_type index = NewNode_(2);
+  Node_ &node = pool_.at(index);
+  try {
+    new (node.storage_) T(std::forward<Args>(args)...);
+  } catch (...) {
+    node.refs_.store(1, std::memory_order_relaxed);
+    Release_(index);
+    throw;
+  }
+  for (;;) {
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    Node_ &last = pool_.at(IndexOf_(tail));
+    uint64_t next = last.next_.load(std::memory_order_acquire);
+    if (tail != tail_.load(std::memory_order_acquire)) continue;
+    if (IndexOf_(next) != pool_type::kNull) {
+      // Another producer linked a node but has not swung tail_ yet.
+      tail_.compare_exchange_strong(tail, Retarget_(tail, IndexOf_(next)),
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed);
+    } else if (last.next_.compare_exchange_weak(
+                   next, Retarget_(next, index), std::memory_order_release,
+                   std::memory_order_relaxed)) {
+      tail_.compare_exchange_strong(tail, Retarget_(tail, index),
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
+template <typename T>
+bool lockfree_queue<T>::try_pop(reference out) {
+  for (;;) {
+    uint64_t head = head_.load(std::memory_order_acquire);
+    uint64_t tail = tail_.load(std::memory_order_acquire);
+    uint64_t next =
+        pool_.at(IndexOf_(head)).next_.load(std::memory_order_acquire);
+    if (head != head_.load(std::memory_order_acquire)) continue;
+    if (IndexOf_(head) == IndexOf_(tail)) {
+      if (IndexOf_(next) == pool_type::kNull) return false;
+      // Never let head_ pass a lagging tail_: help the producer finish.
+      tail_.compare_exchange_strong(tail, Retarget_(tail, IndexOf_(next)),
+                                    std::memory_order_release,
+                                    std::memory_order_relaxed);
+    } else if (head_.compare_exchange_weak(
+                   head, Retarget_(head, IndexOf_(next)),
+                   std::memory_order_acq_rel, std::memory_order_relaxed)) {
+      // The node after the old dummy is the new dummy; its value is ours.
+      T *value = pool_.at(IndexOf_(next)).Value_();
+      out = std::move(*value);
+      value->~T();
+      Release_(IndexOf_(next));
+      Release_(IndexOf_(head));
+      return true;
+    }
+  }
+}
+
+template <typename T>
+bool lockfree_queue<T>::empty() const {
+  uint64_t head = head_.load(std::memory_order_acquire);
+  uint64_t next =
+      pool_.at(IndexOf_(head)).next_.load(std::memory_order_acquire);
+  return IndexOf_(next) == pool_type::kNull;
+}
+
+template <typename T>
+typename lockfree_queue<T>::index_type lockfree_queue<T>::NewNode_(int refs) {
+  index_type index = pool_.allocate();
+  Node_ &node = pool_.at(index);
+  uint64_t link = node.next_.load(std::memory_order_relaxed);
+  node.next_.store(Retarget_(link, pool_type::kNull),
+                   std::memory_order_relaxed);
+  node.refs_.store(refs, std::memory_order_relaxed);
+  return index;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,142 @@
+#ifndef S21_LOCKFREE_STACK_H_
+#define S21_LOCKFREE_STACK_H_
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "../s21_tagged_pool/s21_tagged_pool.h"
+
+namespace s21 {
+// Lock-free LIFO for any number of threads (Treiber). top_ is a tagged
+// link from tagged_pool, so a pop that raced with a pop and push of the
+// same node fails its CAS instead of installing a stale next. Nodes are
+// recycled through the pool and never freed while the stack lives, so a
+// thread may still read a node another thread has just popped.
+template <typename T>
+class lockfree_stack {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Nodes for `reserve` elements are created up front.
+  explicit lockfree_stack(size_type reserve = 0);
+  lockfree_stack(const lockfree_stack &) = delete;
+  lockfree_stack &operator=(const lockfree_stack &) = delete;
+  ~lockfree_stack();
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args);
+  bool try_pop(reference out);
+
+  // Detaches the whole stack with one CAS and calls fn(value_type &) for
+  // each element, newest first. Returns how many elements were taken.
+  template <typename Fn>
+  size_type pop_all(Fn &&fn);
+
+  // Only a snapshot while other threads are pushing or popping.
+  bool empty() const {
+    return pool_type::IndexOf(top_.load(std::memory_order_acquire)) ==
+           pool_type::kNull;
+  }
+  // Distinct nodes used so far; stays flat once pushes and pops are balanced.
+  size_type nodes_created() const { return pool_.nodes_created(); }
+
+ private:
+  static constexpr size_type kCacheLine_ = 64;
+
+  struct Node_ {
+    std::atomic<uint64_t> next_{0};
+    alignas(T) unsigned char storage_[sizeof(T)];
+    T *Value_() { return reinterpret_cast<T *>(storage_); }
+  };
+
+  using pool_type = tagged_pool<Node_>;
+  using index_type = typename pool_type::index_type;
+
+  alignas(kCacheLine_) std::atomic<uint64_t> top_;
+  alignas(kCacheLine_) pool_type pool_;
+};
+
+template <typename T>
+lockfree_stack<T>::lockfree_stack(size_type reserve)
+    : top_(pool_type::Pack(pool_type::kNull, 0)), pool_(reserve) {}
+
+template <typename T>
+lockfree_stack<T>::~lockfree_stack() {
+  pop_all([](reference) {});
+}
+
+template <typename T>
+template <typename... Args>
+void lockfree_stack<T>::emplace(Args &&...args) {
+  index_type index = pool_.allocate();
+  Node_ &node = pool_.at(index);
+  try {
+    new (node.storage_) T(std::forward<Args>(args)...);
+  } catch (...) {
+    pool_.release(index);
+    throw;
+  }
+  uint64_t top = top_.load(std::memory_order_relaxed);
+  do {
+    uint64_t link = node.next_.load(std::memory_order_relaxed);
+    node.next_.store(pool_type::Retarget(link, pool_type::IndexOf(top)),
+                     std::memory_order_relaxed);
+  } while (!top_.compare_exchange_weak(top, pool_type::Retarget(top, index),
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed));
+}
+
+template <typename T>
+bool lockfree_stack<T>::try_pop(reference out) {
+  uint64_t top = top_.load(std::memory_order_acquire);
+  for (;;) {
+    index_type index = pool_type::IndexOf(top);
+    if (index == pool_type::kNull) return false;
+    // May read a node that was just recycled; the tag then fails the CAS.
+    uint64_t next = pool_.at(index).next_.load(std::memory_order_relaxed);
+    if (top_.compare_exchange_weak(
+            top, pool_type::Retarget(top, pool_type::IndexOf(next)),
+            std::memory_order_acquire, std::memory_order_acquire)) {
+      T *value = pool_.at(index).Value_();
+      out = std::move(*value);
+      value->~T();
+      pool_.release(index);
+      return true;
+    }
+  }
+}
+
+template <typename T>
+template <typename Fn>
+typename lockfree_stack<T>::size_type lockfree_stack<T>::pop_all(Fn &&fn) {
+  uint64_t top = top_.load(std::memory_order_relaxed);
+  while (pool_type::IndexOf(top) != pool_type::kNull &&
+         !top_.compare_exchange_weak(
+             top, pool_type::Retarget(top, pool_type::kNull),
+             std::memory_order_acquire, std::memory_order_relaxed)) {
+  }
+  // The detached chain is ours alone.
+  size_type n = 0;
+  index_type index = pool_type::IndexOf(top);
+  while (index != pool_type::kNull) {
+    Node_ &node = pool_.at(index);
+    index_type next =
+        pool_type::IndexOf(node.next_.load(std::memory_order_relaxed));
+    fn(*node.Value_());
+    node.Value_()->~T();
+    pool_.release(index);
+    index = next;
+    ++n;
+  }
+  return n;
+}
+}  // namespace s21
+
+#endif
@@ -1,86 +1,67 @@
 #ifndef S21_MAP_H_
 #define S21_MAP_H_
 
+#include <tuple>
+
 #include "../s21_avl_tree/s21_avl_tree.h"
 
 namespace s21 {
-template <typename K, typename V>
-class map : public Tree<K, V> {
+template <typename K, typename V, order_stats Stats = order_stats::off>
+class map : public Tree<K, V, Stats> {
  public:
-  map() : Tree<K, V>(){};
-  map(std::initializer_list<typename Tree<K, V>::value_type> const &items)
-      : Tree<K, V>(items){};
-  map(const map &m) : Tree<K, V>(m){};
-  map(map &&m) : Tree<K, V>(std::move(m)){};
+  using iterator = typename Tree<K, V, Stats>::iterator;
+  using const_iterator = typename Tree<K, V, Stats>::const_iterator;
+
+  map() : Tree<K, V, Stats>(){};
+  map(std::initializer_list<typename Tree<K, V, Stats>::value_type> const
+          &items)
+      : Tree<K, V, Stats>(items){};
+  template <typename InputIt>
+  map(InputIt first, InputIt last) : Tree<K, V, Stats>(first, last) {}
+  map(const map &m) : Tree<K, V, Stats>(m){};
+  map(map &&m) noexcept : Tree<K, V, Stats>(std::move(m)){};
 
   ~map() = default;
 
-  map &operator=(map &&m) {
-    Tree<K, V>::operator=(std::move(m));
+  map &operator=(const map &m) {
+    Tree<K, V, Stats>::operator=(m);
+    return *this;
+  }
+  map &operator=(map &&m) noexcept {
+    Tree<K, V, Stats>::operator=(std::move(m));
     return *this;
   }
 
   V &operator[](const K &key) {
-    if (!this->contains(key)) {
-      std::pair<K, V> el{key, V()};
-      std::pair<typename Tree<K, V>::Iterator, bool> res_it = this->insert(el);
-      return res_it.first->second;
-    } else {
-      auto it = this->begin();
-      for (; it != this->end(); ++it)
-        if (it->first == key) return it->second;
-      return it->second;
-    }
+    // The mapped value is only built when key is new.
+    auto res =
+        this->Insert_(key, std::piecewise_construct,
+                      std::forward_as_tuple(key), std::forward_as_tuple());
+    return res.first->value_.second;
   }
 
-  const V &at(const K &key) const {
-    V &res = (V &)virtual_;
-    auto tmp = this;
-    At_(key, res, (map<K, V> *)tmp);
-    return res;
-  }
-  std::pair<typename Tree<K, V>::Iterator, bool> insert(
-      const typename Tree<K, V>::value_type &value) override {
-    return Tree<K, V>::insert(value);
+  V &at(const K &key) { return this->find(key)->second; }
+  const V &at(const K &key) const { return this->find(key)->second; }
+
+  // Moves the keys not less than key into the returned map, in O(log n)
+  // with order statistics and O(log n + smaller part) without.
+  map split(const K &key) {
+    map right;
+    this->SplitOff_(key, right);
+    return right;
   }
-  std::pair<typename Tree<K, V>::Iterator, bool> insert(const K &key,
-                                                        const V &obj) {
-    typename Tree<K, V>::Iterator it;
-    bool is_inserted = false;
-    std::pair<K, V> elem{key, obj};
-    this->Insert_(elem, it, is_inserted);
-    std::pair<typename Tree<K, V>::Iterator, bool> res = {it, is_inserted};
-    return res;
+
+  using Tree<K, V, Stats>::insert;
+  std::pair<iterator, bool> insert(const K &key, const V &obj) {
+    auto res = this->Insert_(key, key, obj);
+    return {this->MakeIterator_(res.first), res.second};
   }
-  std::pair<typename Tree<K, V>::Iterator, bool> insert_or_assign(
-      const K &key, const V &obj) {
-    std::pair<typename Tree<K, V>::Iterator, bool> res_it;
-    res_it = insert(key, obj);
-    if (!res_it.second) {
-      auto it = this->begin();
-      while (it->first != key) ++it;
-      res_it.first.SetTree(it.GetTree());
-      res_it.first->second = obj;
-    }
+  std::pair<iterator, bool> insert_or_assign(const K &key, const V &obj) {
+    std::pair<iterator, bool> res_it = insert(key, obj);
+    if (!res_it.second) res_it.first->second = obj;
     return res_it;
   }
-
- private:
-  V virtual_ = V();
-  void At_(const K &key, V &res, map<K, V> *tr) const {
-    if (!tr->root_ ||
-        (!tr->left_ && !tr->right_ && tr->root_->element_.first != key))
-      throw std::out_of_range("Key does not exist");
-
-    if (key < tr->root_->element_.first) {
-      map<K, V>::At_(key, res, (map<K, V> *)tr->left_);
-    } else if (key > tr->root_->element_.first) {
-      map<K, V>::At_(key, res, (map<K, V> *)tr->right_);
-    } else {
-      res = tr->root_->element_.second;
-    }
-  }
 };
 }  // namespace s21
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,93 @@
+#ifndef S21_MONOTONIC_QUEUE_H_
+#define S21_MONOTONIC_QUEUE_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_deque/s21_deque.h"
+
+namespace s21 {
+// FIFO window that also answers min() and max() in O(1). Alongside the
+// elements it keeps two monotonic deques of positions: candidates for the
+// minimum in increasing order and for the maximum in decreasing order. A
+// push drops the candidates the new element beats for good, so every
+// element enters and leaves each deque at most once and push and pop are
+// amortized O(1). Among equal elements the oldest is reported.
+template <typename T, typename Compare = std::less<T>>
+class monotonic_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit monotonic_queue(const Compare &comp = Compare())
+      : comp_(comp), popped_(0) {}
+
+  const_reference front() const { return items_.front(); }
+  const_reference back() const { return items_.back(); }
+  const_reference min() const { return At_(Extreme_(mins_)); }
+  const_reference max() const { return At_(Extreme_(maxs_)); }
+
+  bool empty() const { return items_.empty(); }
+  size_type size() const { return items_.size(); }
+
+  void push(const_reference value) { emplace(value); }
+  void push(value_type &&value) { emplace(std::move(value)); }
+  template <typename... Args>
+  void emplace(Args &&...args);
+  // Removes the oldest element.
+  void pop();
+  void clear();
+
+ private:
+  deque<T> items_;
+  // Absolute positions: the element pushed k-th has position k, and
+  // items_[k - popped_] holds it while it is in the window.
+  deque<size_type> mins_;
+  deque<size_type> maxs_;
+  Compare comp_;
+  size_type popped_;
+
+  const_reference At_(size_type position) const {
+    return items_[position - popped_];
+  }
+  static size_type Extreme_(const deque<size_type> &candidates) {
+    if (candidates.empty())
+      throw std::out_of_range("Monotonic queue is empty");
+    return candidates.front();
+  }
+};
+
+template <typename T, typename Compare>
+template <typename... Args>
+void monotonic_queue<T, Compare>::emplace(Args &&...args) {
+  items_.push_back(T(std::forward<Args>(args)...));
+  const_reference value = items_.back();
+  size_type position = popped_ + items_.size() - 1;
+  while (!mins_.empty() && comp_(value, At_(mins_.back()))) mins_.pop_back();
+  while (!maxs_.empty() && comp_(At_(maxs_.back()), value)) maxs_.pop_back();
+  mins_.push_back(position);
+  maxs_.push_back(position);
+}
+
+template <typename T, typename Compare>
+void monotonic_queue<T, Compare>::pop() {
+  if (items_.empty()) throw std::out_of_range("Monotonic queue is empty");
+  if (mins_.front() == popped_) mins_.pop_front();
+  if (maxs_.front() == popped_) maxs_.pop_front();
+  items_.pop_front();
+  ++popped_;
+}
+
+template <typename T, typename Compare>
+void monotonic_queue<T, Compare>::clear() {
+  popped_ += items_.size();
+  items_.clear();
+  mins_.clear();
+  maxs_.clear();
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,171 @@
+#ifndef S21_MPMC_QUEUE_H_
+#define S21_MPMC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+// Bounded lock-free queue for any number of producers and consumers, built
+// on a power-of-two ring where every cell carries a sequence number. A
+// producer may fill the cell for ticket t only when its sequence is t, and
+// a consumer may drain it only when its sequence is t + 1, so threads
+// contend on one fetch of a position counter and never on a lock.
+template <typename T>
+class mpmc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // The capacity is rounded up to a power of two, at least 2.
+  explicit mpmc_queue(size_type capacity);
+  mpmc_queue(const mpmc_queue &) = delete;
+  mpmc_queue &operator=(const mpmc_queue &) = delete;
+  ~mpmc_queue();
+
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  bool try_pop(reference out);
+
+  // Claim up to n consecutive cells with a single CAS on the position
+  // counter and return how many elements were moved.
+  size_type try_push_n(const value_type *src, size_type n);
+  size_type try_pop_n(value_type *dst, size_type max);
+
+  size_type size_approx() const {
+    size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+    size_type head = dequeue_pos_.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+  }
+  bool empty() const { return size_approx() == 0; }
+  size_type capacity() const { return mask_ + 1; }
+
+ private:
+  static constexpr size_type kCacheLine_ = 64;
+
+  struct Cell_ {
+    std::atomic<size_type> sequence_;
+    alignas(T) unsigned char storage_[sizeof(T)];
+    T *Value_() { return reinterpret_cast<T *>(storage_); }
+  };
+
+  alignas(kCacheLine_) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLine_) std::atomic<size_type> dequeue_pos_;
+  alignas(kCacheLine_) Cell_ *cells_;
+  size_type mask_;
+
+  Cell_ &CellAt_(size_type pos) const { return cells_[pos & mask_]; }
+
+  // Number of cells from pos on whose sequence equals pos + i + lag, i.e.
+  // that are ready for the caller's side; stops at the first one that is
+  // not.
+  size_type ReadyRun_(size_type pos, size_type lag, size_type max) const {
+    size_type k = 0;
+    while (k < max) {
+      size_type seq =
+          CellAt_(pos + k).sequence_.load(std::memory_order_acquire);
+      if (seq != pos + k + lag) break;
+      ++k;
+    }
+    return k;
+  }
+
+  // Claims a run of up to max cells starting at the current value of
+  // counter. Returns the run length (0 when the ring is full or empty for
+  // this side) and stores the first claimed position in pos.
+  size_type Claim_(std::atomic<size_type> &counter, size_type lag,
+                   size_type max, size_type &pos) {
+    pos = counter.load(std::memory_order_relaxed);
+    while (max != 0) {
+      size_type k = ReadyRun_(pos, lag, max);
+      if (k == 0) {
+        size_type seq =
+            CellAt_(pos).sequence_.load(std::memory_order_acquire);
+        // The cell still belongs to the previous lap of the other side.
+        if (static_cast<std::ptrdiff_t>(seq - (pos + lag)) < 0) return 0;
+        pos = counter.load(std::memory_order_relaxed);
+      } else if (counter.compare_exchange_weak(pos, pos + k,
+                                               std::memory_order_relaxed)) {
+        return k;
+      }
+    }
+    return 0;
+  }
+};
+
+template <typename T>
+mpmc_queue<T>::mpmc_queue(size_type capacity)
+    : enqueue_pos_(0), dequeue_pos_(0) {
+  size_type rounded = 2;
+  while (rounded < capacity) rounded <<= 1;
+  cells_ = new Cell_[rounded];
+  for (size_type i = 0; i < rounded; ++i)
+    cells_[i].sequence_.store(i, std::memory_order_relaxed);
+  mask_ = rounded - 1;
+}
+
+template <typename T>
+mpmc_queue<T>::~mpmc_queue() {
+  size_type tail = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type i = dequeue_pos_.load(std::memory_order_relaxed); i != tail;
+       ++i)
+    CellAt_(i).Value_()->~T();
+  delete[] cells_;
+}
+
+template <typename T>
+template <typename... Args>
+bool mpmc_queue<T>::try_emplace(Args &&...args) {
+  size_type pos;
+  if (Claim_(enqueue_pos_, 0, 1, pos) == 0) return false;
+  Cell_ &cell = CellAt_(pos);
+  new (cell.storage_) T(std::forward<Args>(args)...);
+  cell.sequence_.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool mpmc_queue<T>::try_pop(reference out) {
+  size_type pos;
+  if (Claim_(dequeue_pos_, 1, 1, pos) == 0) return false;
+  Cell_ &cell = CellAt_(pos);
+  out = std::move(*cell.Value_());
+  cell.Value_()->~T();
+  cell.sequence_.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_push_n(
+    const value_type *src, size_type n) {
+  size_type pos;
+  size_type k = Claim_(enqueue_pos_, 0, n, pos);
+  for (size_type i = 0; i < k; ++i) {
+    Cell_ &cell = CellAt_(pos + i);
+    new (cell.storage_) T(src[i]);
+    cell.sequence_.store(pos + i + 1, std::memory_order_release);
+  }
+  return k;
+}
+
+template <typename T>
+typename mpmc_queue<T>::size_type mpmc_queue<T>::try_pop_n(value_type *dst,
+                                                           size_type max) {
+  size_type pos;
+  size_type k = Claim_(dequeue_pos_, 1, max, pos);
+  for (size_type i = 0; i < k; ++i) {
+    Cell_ &cell = CellAt_(pos + i);
+    dst[i] = std::move(*cell.Value_());
+    cell.Value_()->~T();
+    cell.sequence_.store(pos + i + mask_ + 1, std::memory_order_release);
+  }
+  return k;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,190 @@
+#include "s21_object_pool.h"
+
+#include <algorithm>
+
+using namespace s21;
+
+template <typename T>
+object_pool<T>::object_pool(size_type slab_objects)
+    : slab_objects_(slab_objects != 0
+                        ? slab_objects
+                        : std::max<size_type>(kSlabBytes_ / sizeof(Slot_),
+                                              kBatch_)),
+      free_(nullptr),
+      carve_(nullptr),
+      carve_end_(nullptr),
+      detached_live_(0) {
+  static std::atomic<uint64_t> pools{0};
+  id_ = pools.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+template <typename T>
+object_pool<T>::~object_pool() {
+  vector<std::shared_ptr<Cache_>> caches;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    caches.swap(caches_);
+  }
+  // Waits for any thread that is just handing its cache back.
+  for (size_type i = 0; i < caches.size(); ++i) {
+    std::lock_guard<std::mutex> lock(caches[i]->mutex_);
+    caches[i]->pool_ = nullptr;
+  }
+  for (size_type i = 0; i < slabs_.size(); ++i)
+    ::operator delete(slabs_[i], std::align_val_t(alignof(Slot_)));
+}
+
+template <typename T>
+template <typename... Args>
+T *object_pool<T>::create(Args &&...args) {
+  Cache_ &cache = MyCache_();
+  if (cache.free_ == nullptr) Refill_(cache);
+  Slot_ *slot = cache.free_;
+  cache.free_ = slot->next_;
+  Add_<size_type>(cache.count_, -1);
+  Add_(cache.live_, 1L);
+  try {
+    return new (slot->storage_) T(std::forward<Args>(args)...);
+  } catch (...) {
+    slot->next_ = cache.free_;
+    cache.free_ = slot;
+    Add_<size_type>(cache.count_, 1);
+    Add_(cache.live_, -1L);
+    throw;
+  }
+}
+
+template <typename T>
+void object_pool<T>::destroy(T *object) {
+  if (object == nullptr) return;
+  object->~T();
+  Slot_ *slot = reinterpret_cast<Slot_ *>(object);
+  Cache_ &cache = MyCache_();
+  slot->next_ = cache.free_;
+  cache.free_ = slot;
+  Add_<size_type>(cache.count_, 1);
+  Add_(cache.live_, -1L);
+  if (cache.count_.load(std::memory_order_relaxed) >= 2 * kBatch_)
+    Spill_(cache, kBatch_);
+}
+
+template <typename T>
+typename object_pool<T>::stats_type object_pool<T>::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_type stats{};
+  long live = detached_live_;
+  for (size_type i = 0; i < caches_.size(); ++i) {
+    stats.cached += caches_[i]->count_.load(std::memory_order_relaxed);
+    live += caches_[i]->live_.load(std::memory_order_relaxed);
+  }
+  stats.slabs = slabs_.size();
+  stats.capacity = slabs_.size() * slab_objects_;
+  stats.in_use = static_cast<size_type>(live);
+  stats.free = stats.capacity - stats.in_use - stats.cached;
+  return stats;
+}
+
+// Called on the owning thread when it exits or reuses the entry for
+// another pool: the free slots and the live count go back to the pool,
+// if it still exists.
+template <typename T>
+void object_pool<T>::Detach_(Cache_ &cache) {
+  std::lock_guard<std::mutex> cache_lock(cache.mutex_);
+  object_pool *pool = cache.pool_;
+  if (pool == nullptr) return;
+  pool->Spill_(cache, cache.count_.load(std::memory_order_relaxed));
+  std::lock_guard<std::mutex> lock(pool->mutex_);
+  pool->detached_live_ += cache.live_.load(std::memory_order_relaxed);
+  cache.live_.store(0, std::memory_order_relaxed);
+  vector<std::shared_ptr<Cache_>> &caches = pool->caches_;
+  for (size_type i = 0; i < caches.size(); ++i) {
+    if (caches[i].get() == &cache) {
+      std::swap(caches[i], caches.back());
+      caches.back().reset();
+      caches.pop_back();
+      break;
+    }
+  }
+  cache.pool_ = nullptr;
+}
+
+template <typename T>
+typename object_pool<T>::Cache_ &object_pool<T>::MyCache_() {
+  static thread_local ThreadCaches_ caches;
+  size_type home = id_ % kThreadSlots_;
+  auto &entry = caches.entries_[home];
+  if (entry.id_ == id_) return *entry.cache_;
+  // The other slots may hold this pool's cache. If not, take a slot that
+  // is unused or whose pool is gone (the entry holds the last reference),
+  // and only evict a live pool's cache when every slot has one.
+  auto *spare = &entry;
+  bool spare_idle = !entry.cache_ || entry.cache_.use_count() == 1;
+  for (size_type i = 1; i < kThreadSlots_; ++i) {
+    auto &other = caches.entries_[(home + i) % kThreadSlots_];
+    if (other.id_ == id_) return *other.cache_;
+    if (!spare_idle && (!other.cache_ || other.cache_.use_count() == 1)) {
+      spare = &other;
+      spare_idle = true;
+    }
+  }
+  return Register_(*spare);
+}
+
+template <typename T>
+typename object_pool<T>::Cache_ &object_pool<T>::Register_(
+    typename ThreadCaches_::Entry_ &entry) {
+  auto cache = std::make_shared<Cache_>();
+  cache->pool_ = this;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    caches_.push_back(cache);
+  }
+  if (entry.cache_) Detach_(*entry.cache_);
+  entry.id_ = id_;
+  entry.cache_ = std::move(cache);
+  return *entry.cache_;
+}
+
+// Moves up to kBatch_ slots into the cache: recycled ones first, then
+// fresh ones carved from the newest slab, starting a new slab if needed.
+template <typename T>
+void object_pool<T>::Refill_(Cache_ &cache) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_type moved = 0;
+  for (; moved < kBatch_ && free_ != nullptr; ++moved) {
+    Slot_ *slot = free_;
+    free_ = slot->next_;
+    slot->next_ = cache.free_;
+    cache.free_ = slot;
+  }
+  if (moved == 0 && carve_ == carve_end_) {
+    Slot_ *slab = static_cast<Slot_ *>(::operator new(
+        slab_objects_ * sizeof(Slot_), std::align_val_t(alignof(Slot_))));
+    try {
+      slabs_.push_back(slab);
+    } catch (...) {
+      ::operator delete(slab, std::align_val_t(alignof(Slot_)));
+      throw;
+    }
+    carve_ = slab;
+    carve_end_ = slab + slab_objects_;
+  }
+  for (; moved < kBatch_ && carve_ != carve_end_; ++moved) {
+    Slot_ *slot = carve_++;
+    slot->next_ = cache.free_;
+    cache.free_ = slot;
+  }
+  Add_(cache.count_, moved);
+}
+
+template <typename T>
+void object_pool<T>::Spill_(Cache_ &cache, size_type n) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (size_type i = 0; i < n; ++i) {
+    Slot_ *slot = cache.free_;
+    cache.free_ = slot->next_;
+    slot->next_ = free_;
+    free_ = slot;
+  }
+  Add_(cache.count_, -n);
+}
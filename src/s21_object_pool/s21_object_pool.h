@@ -0,0 +1,136 @@
+#ifndef S21_OBJECT_POOL_H_
+#define S21_OBJECT_POOL_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+// Allocator for many objects of one type. Objects are carved out of large
+// slabs and freed slots are recycled through free-list stacks, so the
+// general-purpose allocator is only called once per slab and memory goes
+// back to it only when the pool dies.
+//
+// Each thread gets its own cache of free slots, a plain intrusive stack
+// that create() and destroy() use without locks or atomic
+// read-modify-writes. Caches refill from and spill to a shared stack,
+// guarded by a mutex, in batches. When a thread exits, its cache goes back
+// to the shared stack.
+//
+// Every object must be destroyed before the pool.
+template <typename T>
+class object_pool {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  struct stats_type {
+    size_type slabs;
+    size_type capacity;  // Slots in all slabs.
+    size_type in_use;    // Live objects.
+    size_type cached;    // Free slots in the per-thread caches.
+    size_type free;      // The rest: shared stack and uncarved slab space.
+  };
+
+  // Returns objects to the pool they came from; the deleter of handle.
+  class deleter {
+   public:
+    explicit deleter(object_pool *pool = nullptr) : pool_(pool) {}
+    void operator()(T *object) const { pool_->destroy(object); }
+
+   private:
+    object_pool *pool_;
+  };
+  using handle = std::unique_ptr<T, deleter>;
+
+  // slab_objects == 0 sizes slabs at about 64 KiB.
+  explicit object_pool(size_type slab_objects = 0);
+  object_pool(const object_pool &) = delete;
+  object_pool &operator=(const object_pool &) = delete;
+  ~object_pool();
+
+  template <typename... Args>
+  T *create(Args &&...args);
+  void destroy(T *object);
+  template <typename... Args>
+  handle make(Args &&...args) {
+    return handle(create(std::forward<Args>(args)...), deleter(this));
+  }
+
+  size_type slab_objects() const { return slab_objects_; }
+  // Exact only while no other thread is using the pool.
+  stats_type stats() const;
+
+ private:
+  static constexpr size_type kSlabBytes_ = 64 * 1024;
+  static constexpr size_type kBatch_ = 32;
+  // Pools of the same T a thread can use at once without evicting caches.
+  static constexpr size_type kThreadSlots_ = 8;
+
+  union Slot_ {
+    Slot_ *next_;
+    alignas(T) unsigned char storage_[sizeof(T)];
+  };
+
+  struct Cache_ {
+    // Serializes a thread letting go of the cache against the pool dying.
+    std::mutex mutex_;
+    object_pool *pool_ = nullptr;  // Null once either side let go.
+    Slot_ *free_ = nullptr;
+    // Written by the owning thread only; atomic so stats() may read them.
+    // live_ counts creations minus destructions, and may go negative for
+    // a thread that destroys objects created elsewhere.
+    std::atomic<size_type> count_{0};
+    std::atomic<long> live_{0};
+  };
+
+  // A thread's caches. A pool looks first in the entry at its id modulo
+  // kThreadSlots_, then in the others. Ids are never reused, so an entry
+  // for a destroyed pool is simply stale and the first to be taken over.
+  struct ThreadCaches_ {
+    struct Entry_ {
+      uint64_t id_ = 0;
+      std::shared_ptr<Cache_> cache_;
+    };
+    Entry_ entries_[kThreadSlots_];
+    ~ThreadCaches_() {
+      for (Entry_ &entry : entries_)
+        if (entry.cache_) Detach_(*entry.cache_);
+    }
+  };
+
+  uint64_t id_;
+  size_type slab_objects_;
+
+  mutable std::mutex mutex_;
+  Slot_ *free_;
+  // Unused tail of the newest slab.
+  Slot_ *carve_;
+  Slot_ *carve_end_;
+  vector<Slot_ *> slabs_;
+  vector<std::shared_ptr<Cache_>> caches_;
+  // live_ of caches whose thread has let go.
+  long detached_live_;
+
+  template <typename U>
+  static void Add_(std::atomic<U> &counter, U delta) {
+    counter.store(counter.load(std::memory_order_relaxed) + delta,
+                  std::memory_order_relaxed);
+  }
+  static void Detach_(Cache_ &cache);
+
+  Cache_ &MyCache_();
+  Cache_ &Register_(typename ThreadCaches_::Entry_ &entry);
+  void Refill_(Cache_ &cache);
+  void Spill_(Cache_ &cache, size_type n);
+};
+}  // namespace s21
+
+#include "s21_object_pool.cpp"
+
+#endif
@@ -0,0 +1,277 @@
+#include "s21_pairing_heap.h"
+
+using namespace s21;
+
+template <typename T, typename Compare>
+pairing_heap<T, Compare>::pairing_heap() : pairing_heap(Compare()) {}
+
+template <typename T, typename Compare>
+pairing_heap<T, Compare>::pairing_heap(const Compare &comp)
+    : root_(nullptr),
+      size_(0),
+      comp_(comp),
+      blocks_(nullptr),
+      blocks_tail_(nullptr),
+      free_(nullptr),
+      free_tail_(nullptr) {}
+
+template <typename T, typename Compare>
+pairing_heap<T, Compare>::pairing_heap(pairing_heap &&other)
+    : pairing_heap(other.comp_) {
+  swap(other);
+}
+
+template <typename T, typename Compare>
+pairing_heap<T, Compare>::~pairing_heap() {
+  clear();
+}
+
+template <typename T, typename Compare>
+pairing_heap<T, Compare> &pairing_heap<T, Compare>::operator=(
+    pairing_heap &&other) {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename T, typename Compare>
+typename pairing_heap<T, Compare>::const_reference
+pairing_heap<T, Compare>::top() const {
+  if (!root_) throw std::out_of_range("Pairing heap is empty");
+  return root_->value_;
+}
+
+template <typename T, typename Compare>
+typename pairing_heap<T, Compare>::handle pairing_heap<T, Compare>::push(
+    const_reference value) {
+  Node_ *node = NewNode_(value);
+  root_ = root_ ? Link_(root_, node) : node;
+  ++size_;
+  return handle(node);
+}
+
+template <typename T, typename Compare>
+typename pairing_heap<T, Compare>::handle pairing_heap<T, Compare>::push(
+    value_type &&value) {
+  Node_ *node = NewNode_(std::move(value));
+  root_ = root_ ? Link_(root_, node) : node;
+  ++size_;
+  return handle(node);
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::pop() {
+  if (!root_) throw std::out_of_range("Pairing heap is empty");
+  Node_ *old_root = root_;
+  root_ = MergePairs_(root_->child_);
+  DeleteNode_(old_root);
+  --size_;
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::decrease_key(handle h, const_reference value) {
+  DecreaseKey_(h, value);
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::decrease_key(handle h, value_type &&value) {
+  DecreaseKey_(h, std::move(value));
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::erase(handle h) {
+  Node_ *node = h.node_;
+  if (node == root_) {
+    pop();
+    return;
+  }
+  Cut_(node);
+  if (Node_ *children = MergePairs_(node->child_))
+    root_ = Link_(root_, children);
+  DeleteNode_(node);
+  --size_;
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::meld(pairing_heap &other) {
+  if (this == &other || !other.root_) return;
+  root_ = root_ ? Link_(root_, other.root_) : other.root_;
+  size_ += other.size_;
+  if (other.blocks_) {
+    if (blocks_tail_)
+      blocks_tail_[0].next_free_ = other.blocks_;
+    else
+      blocks_ = other.blocks_;
+    blocks_tail_ = other.blocks_tail_;
+  }
+  if (other.free_) {
+    if (free_tail_)
+      free_tail_->next_free_ = other.free_;
+    else
+      free_ = other.free_;
+    free_tail_ = other.free_tail_;
+  }
+  other.root_ = nullptr;
+  other.size_ = 0;
+  other.blocks_ = other.blocks_tail_ = nullptr;
+  other.free_ = other.free_tail_ = nullptr;
+}
+
+// Walks the tree without recursion by keeping the nodes still to visit on a
+// chain through next_, then frees the blocks.
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::clear() {
+  Node_ *pending = root_;
+  while (pending) {
+    Node_ *node = pending;
+    pending = node->next_;
+    if (Node_ *child = node->child_) {
+      Node_ *last = child;
+      while (last->next_) last = last->next_;
+      last->next_ = pending;
+      pending = child;
+    }
+    node->~Node_();
+  }
+  root_ = nullptr;
+  size_ = 0;
+  ReleaseBlocks_();
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::swap(pairing_heap &other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+  std::swap(blocks_, other.blocks_);
+  std::swap(blocks_tail_, other.blocks_tail_);
+  std::swap(free_, other.free_);
+  std::swap(free_tail_, other.free_tail_);
+}
+
+template <typename T, typename Compare>
+template <typename U>
+typename pairing_heap<T, Compare>::Node_ *pairing_heap<T, Compare>::NewNode_(
+    U &&value) {
+  if (!free_) AddBlock_(size_ < kMinBlock_ ? kMinBlock_ : size_);
+  Slot_ *slot = free_;
+  free_ = slot->next_free_;
+  if (!free_) free_tail_ = nullptr;
+  try {
+    return new (&slot->node_) Node_(std::forward<U>(value));
+  } catch (...) {
+    slot->next_free_ = free_;
+    if (!free_) free_tail_ = slot;
+    free_ = slot;
+    throw;
+  }
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::DeleteNode_(Node_ *node) {
+  node->~Node_();
+  Slot_ *slot = reinterpret_cast<Slot_ *>(node);
+  slot->next_free_ = free_;
+  if (!free_) free_tail_ = slot;
+  free_ = slot;
+}
+
+// Only called with an empty free list.
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::AddBlock_(size_type count) {
+  Slot_ *block = new Slot_[count + 1];
+  block[0].next_free_ = blocks_;
+  if (!blocks_) blocks_tail_ = block;
+  blocks_ = block;
+  for (size_type i = count; i > 0; --i) {
+    block[i].next_free_ = free_;
+    free_ = &block[i];
+  }
+  free_tail_ = &block[count];
+}
+
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::ReleaseBlocks_() {
+  while (blocks_) {
+    Slot_ *next = blocks_[0].next_free_;
+    delete[] blocks_;
+    blocks_ = next;
+  }
+  blocks_tail_ = nullptr;
+  free_ = nullptr;
+  free_tail_ = nullptr;
+}
+
+// Joins two detached roots; the loser becomes the winner's first child.
+template <typename T, typename Compare>
+typename pairing_heap<T, Compare>::Node_ *pairing_heap<T, Compare>::Link_(
+    Node_ *a, Node_ *b) {
+  if (comp_(b->value_, a->value_)) std::swap(a, b);
+  b->prev_ = a;
+  b->next_ = a->child_;
+  if (a->child_) a->child_->prev_ = b;
+  a->child_ = b;
+  a->next_ = nullptr;
+  a->prev_ = nullptr;
+  return a;
+}
+
+// Detaches a non-root node, with its subtree, from its parent.
+template <typename T, typename Compare>
+void pairing_heap<T, Compare>::Cut_(Node_ *node) {
+  if (node->prev_->child_ == node)
+    node->prev_->child_ = node->next_;
+  else
+    node->prev_->next_ = node->next_;
+  if (node->next_) node->next_->prev_ = node->prev_;
+  node->next_ = nullptr;
+  node->prev_ = nullptr;
+}
+
+// The standard two-pass merge of a sibling list: link neighbours pairwise
+// from the left, then fold the pairs into one tree from the right. The
+// pairs are kept on a stack through next_ so that no recursion is needed.
+template <typename T, typename Compare>
+typename pairing_heap<T, Compare>::Node_ *
+pairing_heap<T, Compare>::MergePairs_(Node_ *first) {
+  Node_ *pairs = nullptr;
+  while (first) {
+    Node_ *a = first;
+    Node_ *b = a->next_;
+    first = b ? b->next_ : nullptr;
+    a->next_ = nullptr;
+    a->prev_ = nullptr;
+    if (b) {
+      b->next_ = nullptr;
+      b->prev_ = nullptr;
+      a = Link_(a, b);
+    }
+    a->next_ = pairs;
+    pairs = a;
+  }
+  if (!pairs) return nullptr;
+  Node_ *result = pairs;
+  pairs = pairs->next_;
+  result->next_ = nullptr;
+  while (pairs) {
+    Node_ *next = pairs->next_;
+    pairs->next_ = nullptr;
+    result = Link_(result, pairs);
+    pairs = next;
+  }
+  return result;
+}
+
+template <typename T, typename Compare>
+template <typename U>
+void pairing_heap<T, Compare>::DecreaseKey_(handle h, U &&value) {
+  Node_ *node = h.node_;
+  if (comp_(node->value_, value))
+    throw std::invalid_argument("decrease_key would increase the key");
+  node->value_ = std::forward<U>(value);
+  if (node == root_) return;
+  Cut_(node);
+  root_ = Link_(root_, node);
+}
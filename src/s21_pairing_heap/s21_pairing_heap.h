@@ -0,0 +1,121 @@
+#ifndef S21_PAIRING_HEAP_H_
+#define S21_PAIRING_HEAP_H_
+
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Addressable heap: push() returns a handle that stays valid until its
+// element is popped or erased, and through which the element can be moved
+// toward the top or removed. Unlike s21::priority_queue, top() is the
+// element that compares smallest, which is what shortest-path searches
+// want; decrease_key moves an element toward the top.
+//
+// Nodes come from per-heap blocks like those of s21::list, so pushing
+// rarely allocates. meld() hands the other heap's blocks over together
+// with its nodes, so the other heap's handles keep working on this one.
+template <typename T, typename Compare = std::less<T>>
+class pairing_heap {
+  struct Node_;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+  using value_compare = Compare;
+
+  class handle {
+   public:
+    handle() : node_(nullptr) {}
+    const_reference operator*() const { return node_->value_; }
+    const value_type *operator->() const { return &node_->value_; }
+    bool operator==(const handle &other) const { return node_ == other.node_; }
+    bool operator!=(const handle &other) const { return node_ != other.node_; }
+
+   private:
+    friend class pairing_heap;
+    explicit handle(Node_ *node) : node_(node) {}
+    Node_ *node_;
+  };
+
+  pairing_heap();
+  explicit pairing_heap(const Compare &comp);
+  // Handles cannot follow a copy, so heaps are move-only.
+  pairing_heap(const pairing_heap &) = delete;
+  pairing_heap(pairing_heap &&other);
+  ~pairing_heap();
+
+  pairing_heap &operator=(const pairing_heap &) = delete;
+  pairing_heap &operator=(pairing_heap &&other);
+
+  const_reference top() const;
+  bool empty() const { return size_ == 0; }
+  size_type size() const { return size_; }
+
+  handle push(const_reference value);
+  handle push(value_type &&value);
+  void pop();
+  // Replaces the element's value with one that does not compare greater.
+  void decrease_key(handle h, const_reference value);
+  void decrease_key(handle h, value_type &&value);
+  void erase(handle h);
+  // Moves every element of other into this heap in O(1).
+  void meld(pairing_heap &other);
+  void clear();
+  void swap(pairing_heap &other);
+
+ private:
+  struct Node_ {
+    template <typename U>
+    explicit Node_(U &&value)
+        : value_(std::forward<U>(value)),
+          child_(nullptr),
+          next_(nullptr),
+          prev_(nullptr) {}
+
+    T value_;
+    Node_ *child_;
+    Node_ *next_;
+    // The previous sibling, or the parent for a first child.
+    Node_ *prev_;
+  };
+
+  union Slot_ {
+    Slot_ *next_free_;
+    Node_ node_;
+    Slot_() : next_free_(nullptr) {}
+    ~Slot_() {}
+  };
+
+  static constexpr size_type kMinBlock_ = 16;
+
+  Node_ *root_;
+  size_type size_;
+  Compare comp_;
+  // Blocks are chained through their first slot; the tails let meld()
+  // splice both chains in O(1).
+  Slot_ *blocks_;
+  Slot_ *blocks_tail_;
+  Slot_ *free_;
+  Slot_ *free_tail_;
+
+  template <typename U>
+  Node_ *NewNode_(U &&value);
+  void DeleteNode_(Node_ *node);
+  void AddBlock_(size_type count);
+  void ReleaseBlocks_();
+
+  Node_ *Link_(Node_ *a, Node_ *b);
+  void Cut_(Node_ *node);
+  Node_ *MergePairs_(Node_ *first);
+  template <typename U>
+  void DecreaseKey_(handle h, U &&value);
+};
+}  // namespace s21
+
+#include "s21_pairing_heap.cpp"
+
+#endif
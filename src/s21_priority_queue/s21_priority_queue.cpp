@@ -0,0 +1,119 @@
+#include "s21_priority_queue.h"
+
+using namespace s21;
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+priority_queue<T, ContainerT, Compare, Arity>::priority_queue(
+    std::initializer_list<value_type> const &items)
+    : priority_queue(items.begin(), items.end()) {}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+template <typename InputIt>
+priority_queue<T, ContainerT, Compare, Arity>::priority_queue(
+    InputIt first, InputIt last, const Compare &comp)
+    : container_(), comp_(comp) {
+  for (; first != last; ++first) container_.push_back(*first);
+  Heapify_();
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+typename priority_queue<T, ContainerT, Compare, Arity>::const_reference
+priority_queue<T, ContainerT, Compare, Arity>::top() const {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  return container_[0];
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::push(
+    const_reference value) {
+  container_.push_back(value);
+  SiftUp_(size() - 1);
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+  SiftUp_(size() - 1);
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+template <typename InputIt>
+void priority_queue<T, ContainerT, Compare, Arity>::push_range(InputIt first,
+                                                               InputIt last) {
+  size_type old_size = size();
+  for (; first != last; ++first) container_.push_back(*first);
+  size_type added = size() - old_size;
+  // Sifting up costs about log(n) per element and a rebuild about 2n in
+  // total, so rebuild once the batch is a sizeable part of the heap.
+  if (added > old_size / 4) {
+    Heapify_();
+  } else {
+    for (size_type i = old_size; i < size(); ++i) SiftUp_(i);
+  }
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::pop() {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  if (size() > 1) {
+    container_[0] = std::move(container_[size() - 1]);
+    container_.pop_back();
+    SiftDown_(0);
+  } else {
+    container_.pop_back();
+  }
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+typename priority_queue<T, ContainerT, Compare, Arity>::value_type
+priority_queue<T, ContainerT, Compare, Arity>::replace_top(value_type value) {
+  if (empty()) throw std::out_of_range("Priority queue is empty");
+  std::swap(container_[0], value);
+  SiftDown_(0);
+  return value;
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::swap(
+    priority_queue &other) {
+  container_.swap(other.container_);
+  std::swap(comp_, other.comp_);
+}
+
+// Floyd's construction: sift down every inner node, deepest first.
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::Heapify_() {
+  if (size() < 2) return;
+  for (size_type i = Parent_(size() - 1) + 1; i-- != 0;) SiftDown_(i);
+}
+
+// Both sifts move a hole instead of swapping, so each level costs one move.
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::SiftUp_(size_type hole) {
+  value_type value = std::move(container_[hole]);
+  while (hole != 0) {
+    size_type parent = Parent_(hole);
+    if (!comp_(container_[parent], value)) break;
+    container_[hole] = std::move(container_[parent]);
+    hole = parent;
+  }
+  container_[hole] = std::move(value);
+}
+
+template <typename T, typename ContainerT, typename Compare, size_t Arity>
+void priority_queue<T, ContainerT, Compare, Arity>::SiftDown_(size_type hole) {
+  size_type n = size();
+  value_type value = std::move(container_[hole]);
+  for (;;) {
+    size_type first = FirstChild_(hole);
+    if (first >= n) break;
+    size_type last = first + Arity < n ? first + Arity : n;
+    size_type best = first;
+    for (size_type child = first + 1; child < last; ++child)
+      if (comp_(container_[best], container_[child])) best = child;
+    if (!comp_(value, container_[best])) break;
+    container_[hole] = std::move(container_[best]);
+    hole = best;
+  }
+  container_[hole] = std::move(value);
+}
@@ -0,0 +1,85 @@
+#ifndef S21_PRIORITY_QUEUE_H_
+#define S21_PRIORITY_QUEUE_H_
+
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+// Heap adaptor over a random-access container. top() is the element that
+// compares largest, as with std::priority_queue. Every node has Arity
+// children stored next to each other, so a 4-ary heap is half as deep as a
+// binary one and a sift-down compares siblings that share a cache line.
+template <typename T, typename ContainerT = s21::vector<T>,
+          typename Compare = std::less<T>, size_t Arity = 4>
+class priority_queue {
+  static_assert(Arity >= 2, "a heap node needs at least two children");
+
+ public:
+  using value_type = typename ContainerT::value_type;
+  using reference = typename ContainerT::reference;
+  using const_reference = typename ContainerT::const_reference;
+  using size_type = typename ContainerT::size_type;
+  using container_type = ContainerT;
+  using value_compare = Compare;
+
+  priority_queue() : container_(), comp_() {}
+  explicit priority_queue(const Compare &comp) : container_(), comp_(comp) {}
+  priority_queue(std::initializer_list<value_type> const &items);
+  // Builds the heap in O(n).
+  template <typename InputIt>
+  priority_queue(InputIt first, InputIt last, const Compare &comp = Compare());
+  priority_queue(const priority_queue &other)
+      : container_(other.container_), comp_(other.comp_) {}
+  priority_queue(priority_queue &&other)
+      : container_(std::move(other.container_)), comp_(other.comp_) {}
+  ~priority_queue() {}
+
+  priority_queue &operator=(const priority_queue &other) {
+    if (this != &other) {
+      priority_queue tmp(other);
+      swap(tmp);
+    }
+    return *this;
+  }
+  priority_queue &operator=(priority_queue &&other) {
+    container_ = std::move(other.container_);
+    comp_ = other.comp_;
+    return *this;
+  }
+
+  const_reference top() const;
+  bool empty() const { return container_.size() == 0; }
+  size_type size() const { return container_.size(); }
+
+  void push(const_reference value);
+  void push(value_type &&value);
+  // Appends a range and restores the heap, rebuilding it from scratch when
+  // that is cheaper than sifting every new element up.
+  template <typename InputIt>
+  void push_range(InputIt first, InputIt last);
+  void pop();
+  // pop() followed by push(value) with a single sift-down; returns the old
+  // top. The usual step of a bounded top-k or k-way merge.
+  value_type replace_top(value_type value);
+  void swap(priority_queue &other);
+
+ private:
+  ContainerT container_;
+  Compare comp_;
+
+  static size_type Parent_(size_type i) { return (i - 1) / Arity; }
+  static size_type FirstChild_(size_type i) { return i * Arity + 1; }
+
+  void Heapify_();
+  void SiftUp_(size_type hole);
+  void SiftDown_(size_type hole);
+};
+}  // namespace s21
+
+#include "s21_priority_queue.cpp"
+
+#endif
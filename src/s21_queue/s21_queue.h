@@ -1,10 +1,11 @@
 #ifndef S21_QUEUE
 #define S21_QUEUE
 
+#include "../s21_deque/s21_deque.h"
 #include "../s21_list/s21_list.h"
 
 namespace s21 {
-template <typename T, typename ContainerT = s21::list<T>>
+template <typename T, typename ContainerT = s21::deque<T>>
 class queue {
  public:
   using value_type = typename ContainerT::value_type;
@@ -14,6 +15,8 @@ class queue {
 
   queue() : container() {}
   queue(std::initializer_list<value_type> const &items) : container(items) {}
+  explicit queue(const ContainerT &other) : container(other) {}
+  explicit queue(ContainerT &&other) : container(std::move(other)) {}
   queue(const queue &other) : container(other.container) {}
   queue(queue &&other) : container(std::move(other.container)) {}
   ~queue() {}
@@ -23,18 +26,31 @@ class queue {
     return *this;
   }
 
-  const_reference front() { return container.front(); }
-  const_reference back() { return container.back(); }
+  // An empty queue gives a value-initialised element from front() and
+  // back() and ignores pop(), as it did when it sat on s21::list.
+  const_reference front() {
+    return container.empty() ? EmptyValue_() : container.front();
+  }
+  const_reference back() {
+    return container.empty() ? EmptyValue_() : container.back();
+  }
 
   bool empty() { return container.empty(); }
   size_type size() { return container.size(); }
 
   void push(const_reference value) { this->container.push_back(value); }
-  void pop() { this->container.pop_front(); }
+  void pop() {
+    if (!this->container.empty()) this->container.pop_front();
+  }
   void swap(queue &other) { this->container.swap(other.container); }
 
  private:
   ContainerT container;
+
+  static const_reference EmptyValue_() {
+    static const value_type value{};
+    return value;
+  }
 };
 
 }  // namespace s21
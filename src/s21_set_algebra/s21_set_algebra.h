@@ -0,0 +1,291 @@
+#ifndef S21_SET_ALGEBRA_H_
+#define S21_SET_ALGEBRA_H_
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "../s21_avl_tree/s21_avl_tree.h"
+#include "../s21_executor/s21_executor.h"
+#include "../s21_map/s21_map.h"
+#include "../s21_set/s21_set.h"
+
+namespace s21 {
+namespace tree_detail {
+template <typename K, typename V, order_stats S>
+Tree<K, V, S> TreeOf(const Tree<K, V, S> &);  // Only names the base.
+
+template <typename Container>
+using TreeBase = decltype(TreeOf(std::declval<const Container &>()));
+
+// Container, if it is an s21::set or s21::map.
+template <typename Container>
+using IfTree = std::enable_if_t<
+    std::is_base_of<TreeBase<Container>, Container>::value, Container>;
+
+// Builds the union, intersection or (symmetric) difference of two trees
+// without touching them. The recursion follows the smaller tree; each of
+// its keys is looked up in the matching key range of the larger one, and
+// the halves are put back together with Tree::Join_. The ranges narrow as
+// the recursion descends, so the work is O(m log(n / m + 1)) plus the size
+// of the output, and the halves run as tasks when an executor is given.
+// Ranges of the larger tree are copied by rank, in parallel, when it keeps
+// order statistics, and by walking them otherwise.
+template <typename Container>
+class SetAlgebra {
+  using Tree_ = TreeBase<Container>;
+  using Node_ = typename Tree_::Node_;
+  using K = typename Container::key_type;
+  using size_type = typename Tree_::size_type;
+  using value_type = typename Tree_::value_type;
+
+ public:
+  // Which keys make it into the result: those only in the first operand,
+  // only in the second, or in both (with the first operand's element).
+  struct Op {
+    bool first_only;
+    bool second_only;
+    bool both;
+  };
+
+  SetAlgebra(executor *ex, Op op) : ex_(ex), op_(op) {}
+
+  Container Run(const Container &first, const Container &second) {
+    first_small_ = first.size() <= second.size();
+    const Tree_ &small = first_small_ ? first : second;
+    other_ = first_small_ ? &second : &first;
+    small_only_ = first_small_ ? op_.first_only : op_.second_only;
+    other_only_ = first_small_ ? op_.second_only : op_.first_only;
+    Container result;
+    Tree_ &tree = result;
+    tree.root_ = Combine_(small.root_, other_->root_, nullptr, nullptr);
+    tree.size_ = Tree_::SizeOf_(tree.root_);
+    tree.FindEnds_();
+    return result;
+  }
+
+ private:
+  // Below this many elements a piece is done on the current thread.
+  static constexpr size_type kGrain_ = 2048;
+  static constexpr bool kCounted_ = Tree_::kCounted_;
+
+  executor *ex_;
+  Op op_;
+  const Tree_ *other_ = nullptr;
+  bool first_small_ = true;
+  bool small_only_ = false;
+  bool other_only_ = false;
+
+  // small's subtree against the keys of the other tree in (lo, hi), null
+  // meaning unbounded; other is the top of a subtree holding all of them.
+  Node_ *Combine_(const Node_ *small, const Node_ *other, const K *lo,
+                  const K *hi) {
+    other = Narrow_(other, lo, hi);
+    if (!small) return other_only_ && other ? CopyRange_(lo, hi) : nullptr;
+    if (!other) return small_only_ ? Tree_::Clone_(small, nullptr) : nullptr;
+    const K &key = Tree_::KeyOf_(small);
+    const Node_ *match = other;
+    while (match) {
+      if (key < Tree_::KeyOf_(match))
+        match = match->left_;
+      else if (Tree_::KeyOf_(match) < key)
+        match = match->right_;
+      else
+        break;
+    }
+    Node_ *left;
+    Node_ *right;
+    Fork_(
+        Work_(small), left,
+        [&] { return Combine_(small->left_, other, lo, &key); }, right,
+        [&] { return Combine_(small->right_, other, &key, hi); });
+    const Node_ *keep = nullptr;
+    if (!match && small_only_)
+      keep = small;
+    else if (match && op_.both)
+      keep = first_small_ ? small : match;
+    return keep ? Join_(left, &keep->value_, right) : Join_(left, right);
+  }
+
+  // The highest node of subtree whose key is in (lo, hi).
+  static const Node_ *Narrow_(const Node_ *node, const K *lo, const K *hi) {
+    while (node) {
+      if (lo && !(*lo < Tree_::KeyOf_(node)))
+        node = node->right_;
+      else if (hi && !(Tree_::KeyOf_(node) < *hi))
+        node = node->left_;
+      else
+        break;
+    }
+    return node;
+  }
+
+  Node_ *CopyRange_(const K *lo, const K *hi) {
+    if constexpr (kCounted_) {
+      size_type first = lo ? other_->rank(*lo) + other_->count(*lo) : 0;
+      size_type last = hi ? other_->rank(*hi) : other_->size();
+      return CopyRanks_(first, last);
+    } else {
+      Node_ *first =
+          lo ? other_->UpperBound_(*lo) : Tree_::Min_(other_->root_);
+      size_type n = 0;
+      for (Node_ *node = first; node && (!hi || Tree_::KeyOf_(node) < *hi);
+           node = Tree_::Next_(node))
+        ++n;
+      auto it = other_->MakeIterator_(first);
+      return Tree_::Build_(it, n, nullptr);
+    }
+  }
+
+  // Elements under node, or with no counts a bound from its height.
+  static size_type Work_(const Node_ *node) {
+    if (kCounted_) return node->count_;
+    return (size_type(1) << node->height_) - 1;
+  }
+
+  // A balanced copy of the other tree's elements ranked [first, last).
+  Node_ *CopyRanks_(size_type first, size_type last) {
+    size_type n = last - first;
+    if (n == 0) return nullptr;
+    if (!ex_ || n < kGrain_) {
+      auto it = other_->nth_element(first);
+      return Tree_::Build_(it, n, nullptr);
+    }
+    size_type mid = first + n / 2;
+    Node_ *left;
+    Node_ *right;
+    Fork_(
+        n, left, [&] { return CopyRanks_(first, mid); }, right,
+        [&] { return CopyRanks_(mid + 1, last); });
+    return Join_(left, &*other_->nth_element(mid), right);
+  }
+
+  // Runs both halves, as a task and inline when work is large enough. If
+  // either throws, what the other built is freed and the error rethrown.
+  template <typename MakeLeft, typename MakeRight>
+  void Fork_(size_type work, Node_ *&left, MakeLeft make_left, Node_ *&right,
+             MakeRight make_right) {
+    left = nullptr;
+    right = nullptr;
+    std::exception_ptr error;
+    if (ex_ && work >= kGrain_) {
+      task_group group(*ex_);
+      group.spawn([&] { left = make_left(); });
+      try {
+        right = make_right();
+      } catch (...) {
+        error = std::current_exception();
+      }
+      try {
+        group.wait();
+      } catch (...) {
+        if (!error) error = std::current_exception();
+      }
+    } else {
+      try {
+        left = make_left();
+        right = make_right();
+      } catch (...) {
+        error = std::current_exception();
+      }
+    }
+    if (error) {
+      Tree_::Destroy_(left);
+      Tree_::Destroy_(right);
+      std::rethrow_exception(error);
+    }
+  }
+
+  // left, a copy of value and right, whose keys are in that order. The
+  // temporary trees free both sides if the copy throws.
+  static Node_ *Join_(Node_ *left, const value_type *value, Node_ *right) {
+    Tree_ low;
+    Tree_ high;
+    low.root_ = left;
+    high.root_ = right;
+    low.Join_(new Node_(nullptr, *value), high);
+    Node_ *root = low.root_;
+    low.root_ = nullptr;
+    return root;
+  }
+
+  static Node_ *Join_(Node_ *left, Node_ *right) {
+    if (!left) return right;
+    if (!right) return left;
+    Tree_ low;
+    Tree_ high;
+    low.root_ = left;
+    high.root_ = right;
+    Node_ *mid = Tree_::Min_(right);
+    high.Unlink_(mid);
+    low.Join_(mid, high);
+    Node_ *root = low.root_;
+    low.root_ = nullptr;
+    return root;
+  }
+};
+
+template <typename Container>
+Container Combine(executor *ex, const Container &first,
+                  const Container &second,
+                  typename SetAlgebra<Container>::Op op) {
+  return SetAlgebra<Container>(ex, op).Run(first, second);
+}
+}  // namespace tree_detail
+
+// Set algebra on s21::set and s21::map, returning a new container. Where
+// both operands hold a key, the element comes from the first. The overloads
+// taking an executor split the work into tasks on it.
+template <typename Container>
+tree_detail::IfTree<Container> set_union(const Container &first,
+                                         const Container &second) {
+  return tree_detail::Combine(nullptr, first, second, {true, true, true});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> set_union(executor &ex, const Container &first,
+                                         const Container &second) {
+  return tree_detail::Combine(&ex, first, second, {true, true, true});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> set_intersection(const Container &first,
+                                                const Container &second) {
+  return tree_detail::Combine(nullptr, first, second, {false, false, true});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> set_intersection(executor &ex,
+                                                const Container &first,
+                                                const Container &second) {
+  return tree_detail::Combine(&ex, first, second, {false, false, true});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> set_difference(const Container &first,
+                                              const Container &second) {
+  return tree_detail::Combine(nullptr, first, second, {true, false, false});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> set_difference(executor &ex,
+                                              const Container &first,
+                                              const Container &second) {
+  return tree_detail::Combine(&ex, first, second, {true, false, false});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> symmetric_difference(const Container &first,
+                                                    const Container &second) {
+  return tree_detail::Combine(nullptr, first, second, {true, true, false});
+}
+
+template <typename Container>
+tree_detail::IfTree<Container> symmetric_difference(executor &ex,
+                                                    const Container &first,
+                                                    const Container &second) {
+  return tree_detail::Combine(&ex, first, second, {true, true, false});
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef S21_SPSC_QUEUE_H_
+#define S21_SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace s21 {
+// Bounded wait-free queue for exactly one producer thread and one consumer
+// thread. Each side owns its index on a separate cache line and keeps a
+// cached copy of the other side's index, so the shared lines are only read
+// when the queue looks full (producer) or empty (consumer).
+template <typename T>
+class spsc_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // The capacity is rounded up to a power of two.
+  explicit spsc_queue(size_type capacity);
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+  ~spsc_queue();
+
+  // Producer side.
+  bool try_push(const_reference value) { return try_emplace(value); }
+  bool try_push(value_type &&value) { return try_emplace(std::move(value)); }
+  template <typename... Args>
+  bool try_emplace(Args &&...args);
+  // Pushes up to n elements from src and returns how many were pushed.
+  size_type try_push_n(const value_type *src, size_type n);
+
+  // Consumer side.
+  bool try_pop(reference out);
+  // Pops up to max elements into dst and returns how many were popped.
+  size_type try_pop_n(value_type *dst, size_type max);
+
+  // Exact only when called from one of the two sides while the other one is
+  // idle. head_ is read first: tail_ can only have moved on since, so the
+  // difference never wraps, and it is capped at the capacity.
+  size_type size_approx() const {
+    size_type head = head_.load(std::memory_order_acquire);
+    size_type size = tail_.load(std::memory_order_acquire) - head;
+    return size < capacity() ? size : capacity();
+  }
+  bool empty() const { return size_approx() == 0; }
+  size_type capacity() const { return mask_ + 1; }
+
+ private:
+  static constexpr size_type kCacheLine_ = 64;
+
+  // Written by the consumer.
+  alignas(kCacheLine_) std::atomic<size_type> head_;
+  size_type cached_tail_;
+  // Written by the producer.
+  alignas(kCacheLine_) std::atomic<size_type> tail_;
+  size_type cached_head_;
+  // Read-only after construction.
+  alignas(kCacheLine_) T *slots_;
+  size_type mask_;
+
+  // Free slots the producer may fill without looking at head_ again.
+  size_type FreeSlots_(size_type tail) {
+    size_type free_slots = capacity() - (tail - cached_head_);
+    if (free_slots == 0) {
+      cached_head_ = head_.load(std::memory_order_acquire);
+      free_slots = capacity() - (tail - cached_head_);
+    }
+    return free_slots;
+  }
+
+  // Filled slots the consumer may drain without looking at tail_ again.
+  size_type FilledSlots_(size_type head) {
+    size_type filled = cached_tail_ - head;
+    if (filled == 0) {
+      cached_tail_ = tail_.load(std::memory_order_acquire);
+      filled = cached_tail_ - head;
+    }
+    return filled;
+  }
+};
+
+template <typename T>
+spsc_queue<T>::spsc_queue(size_type capacity)
+    : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {
+  size_type rounded = 1;
+  while (rounded < capacity) rounded <<= 1;
+  slots_ = static_cast<T *>(::operator new(rounded * sizeof(T)));
+  mask_ = rounded - 1;
+}
+
+template <typename T>
+spsc_queue<T>::~spsc_queue() {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  for (size_type i = head_.load(std::memory_order_relaxed); i != tail; ++i)
+    slots_[i & mask_].~T();
+  ::operator delete(slots_);
+}
+
+template <typename T>
+template <typename... Args>
+bool spsc_queue<T>::try_emplace(Args &&...args) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  if (FreeSlots_(tail) == 0) return false;
+  new (slots_ + (tail & mask_)) T(std::forward<Args>(args)...);
+  tail_.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_push_n(
+    const value_type *src, size_type n) {
+  size_type tail = tail_.load(std::memory_order_relaxed);
+  size_type free_slots = FreeSlots_(tail);
+  if (n > free_slots) {
+    cached_head_ = head_.load(std::memory_order_acquire);
+    free_slots = capacity() - (tail - cached_head_);
+    if (n > free_slots) n = free_slots;
+  }
+  for (size_type i = 0; i < n; ++i)
+    new (slots_ + ((tail + i) & mask_)) T(src[i]);
+  if (n != 0) tail_.store(tail + n, std::memory_order_release);
+  return n;
+}
+
+template <typename T>
+bool spsc_queue<T>::try_pop(reference out) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  if (FilledSlots_(head) == 0) return false;
+  T *slot = slots_ + (head & mask_);
+  out = std::move(*slot);
+  slot->~T();
+  head_.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+typename spsc_queue<T>::size_type spsc_queue<T>::try_pop_n(value_type *dst,
+                                                           size_type max) {
+  size_type head = head_.load(std::memory_order_relaxed);
+  size_type filled = FilledSlots_(head);
+  if (max > filled) {
+    cached_tail_ = tail_.load(std::memory_order_acquire);
+    filled = cached_tail_ - head;
+    if (max > filled) max = filled;
+  }
+  for (size_type i = 0; i < max; ++i) {
+    T *slot = slots_ + ((head + i) & mask_);
+    dst[i] = std::move(*slot);
+    slot->~T();
+  }
+  if (max != 0) head_.store(head + max, std::memory_order_release);
+  return max;
+}
+}  // namespace s21
+
+#endif
@@ -0,0 +1,136 @@
+#ifndef S21_TAGGED_POOL_H_
+#define S21_TAGGED_POOL_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace s21 {
+// Type-stable storage for the nodes of lock-free containers. Nodes are
+// addressed by 32-bit indices and are never returned to the system before
+// the pool is destroyed, so a thread may still read a node that another
+// thread has just recycled. Links are 64-bit words that pack an index with
+// a tag; bumping the tag on every change makes a CAS fail when a node was
+// recycled in between (the ABA problem).
+//
+// NodeT must be default constructible and have a member
+// std::atomic<uint64_t> next_, which the pool uses to chain free nodes.
+template <typename NodeT>
+class tagged_pool {
+ public:
+  using index_type = uint32_t;
+  using tag_type = uint32_t;
+  using size_type = size_t;
+
+  static constexpr index_type kNull = UINT32_MAX;
+
+  static uint64_t Pack(index_type index, tag_type tag) {
+    return static_cast<uint64_t>(tag) << 32 | index;
+  }
+  static index_type IndexOf(uint64_t link) {
+    return static_cast<index_type>(link);
+  }
+  static tag_type TagOf(uint64_t link) {
+    return static_cast<tag_type>(link >> 32);
+  }
+  // The same target with the next tag.
+  static uint64_t Retarget(uint64_t link, index_type index) {
+    return Pack(index, TagOf(link) + 1);
+  }
+
+  // Nodes for the first `reserve` allocations are created up front.
+  explicit tagged_pool(size_type reserve = 0);
+  tagged_pool(const tagged_pool &) = delete;
+  tagged_pool &operator=(const tagged_pool &) = delete;
+  ~tagged_pool();
+
+  NodeT &at(index_type index) const {
+    int chunk = Chunk_(index);
+    NodeT *nodes = chunks_[chunk].load(std::memory_order_acquire);
+    return nodes[Offset_(index, chunk)];
+  }
+
+  // Lock-free; only touches the allocator when a new chunk is needed.
+  index_type allocate();
+  void release(index_type index);
+
+  // Number of distinct nodes ever handed out.
+  size_type nodes_created() const {
+    return fresh_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  // Chunk c holds kFirstChunk_ << c nodes, so 26 chunks cover every index
+  // below kNull.
+  static constexpr size_type kFirstChunk_ = 64;
+  static constexpr int kMaxChunks_ = 26;
+
+  std::atomic<NodeT *> chunks_[kMaxChunks_];
+  alignas(64) std::atomic<uint64_t> free_top_;
+  alignas(64) std::atomic<size_type> fresh_;
+
+  static int Chunk_(size_type index) {
+    return 63 - __builtin_clzll(index / kFirstChunk_ + 1);
+  }
+  static size_type Offset_(size_type index, int chunk) {
+    return index - kFirstChunk_ * ((size_type(1) << chunk) - 1);
+  }
+  void EnsureChunk_(int chunk);
+};
+
+template <typename NodeT>
+tagged_pool<NodeT>::tagged_pool(size_type reserve)
+    : free_top_(Pack(kNull, 0)), fresh_(0) {
+  for (auto &chunk : chunks_) chunk.store(nullptr, std::memory_order_relaxed);
+  for (int c = 0; reserve != 0 && c <= Chunk_(reserve - 1); ++c)
+    EnsureChunk_(c);
+}
+
+template <typename NodeT>
+tagged_pool<NodeT>::~tagged_pool() {
+  for (auto &chunk : chunks_) delete[] chunk.load(std::memory_order_relaxed);
+}
+
+template <typename NodeT>
+typename tagged_pool<NodeT>::index_type tagged_pool<NodeT>::allocate() {
+  uint64_t top = free_top_.load(std::memory_order_acquire);
+  while (IndexOf(top) != kNull) {
+    // The node may be reused under our feet; the tag then fails the CAS.
+    uint64_t next = at(IndexOf(top)).next_.load(std::memory_order_relaxed);
+    if (free_top_.compare_exchange_weak(top, Retarget(top, IndexOf(next)),
+                                        std::memory_order_acquire,
+                                        std::memory_order_acquire))
+      return IndexOf(top);
+  }
+  size_type index = fresh_.fetch_add(1, std::memory_order_relaxed);
+  if (index >= kNull) throw std::bad_alloc();
+  EnsureChunk_(Chunk_(index));
+  return static_cast<index_type>(index);
+}
+
+template <typename NodeT>
+void tagged_pool<NodeT>::release(index_type index) {
+  NodeT &node = at(index);
+  uint64_t top = free_top_.load(std::memory_order_relaxed);
+  do {
+    uint64_t link = node.next_.load(std::memory_order_relaxed);
+    node.next_.store(Retarget(link, IndexOf(top)), std::memory_order_relaxed);
+  } while (!free_top_.compare_exchange_weak(top, Retarget(top, index),
+                                            std::memory_order_release,
+                                            std::memory_order_relaxed));
+}
+
+// Racing threads may both build the chunk; the loser frees its copy.
+template <typename NodeT>
+void tagged_pool<NodeT>::EnsureChunk_(int chunk) {
+  if (chunks_[chunk].load(std::memory_order_acquire)) return;
+  NodeT *fresh_chunk = new NodeT[kFirstChunk_ << chunk];
+  NodeT *expected = nullptr;
+  if (!chunks_[chunk].compare_exchange_strong(expected, fresh_chunk,
+                                              std::memory_order_acq_rel))
+    delete[] fresh_chunk;
+}
+}  // namespace s21
+
+#endif
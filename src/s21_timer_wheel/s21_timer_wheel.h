@@ -0,0 +1,157 @@
+#ifndef S21_TIMER_WHEEL_H_
+#define S21_TIMER_WHEEL_H_
+
+#include <cstdint>
+
+#include "../s21_intrusive_list/s21_intrusive_list.h"
+
+namespace s21 {
+class timer_wheel;
+
+// A timeout owned by the user, typically as a base or member of a
+// connection object. It carries an auto-unlink hook, so destroying a
+// scheduled timer simply cancels it.
+class timer {
+ public:
+  timer() : deadline_(0) {}
+
+  bool scheduled() const { return hook_.is_linked(); }
+  uint64_t deadline() const { return deadline_; }
+
+ private:
+  friend class timer_wheel;
+
+  auto_unlink_hook hook_;
+  uint64_t deadline_;
+};
+
+// Hierarchical timing wheel over integer ticks. Level l has 64 slots of
+// 64^l ticks each, so four levels cover 64^4 (about 16.7 million) ticks;
+// timers further out wait on an overflow list. A timer sits in exactly one
+// slot, an intrusive list, so schedule, reschedule and cancel are O(1) and
+// never allocate. When time advances, the slot for each tick is taken off
+// the wheel as a whole and its timers are handed to the callback; a slot
+// on a higher level is redistributed to the levels below when the wheel
+// reaches it.
+class timer_wheel {
+ public:
+  using size_type = size_t;
+
+  explicit timer_wheel(uint64_t now = 0) : now_(now), occupied_(0) {}
+  timer_wheel(const timer_wheel &) = delete;
+  timer_wheel &operator=(const timer_wheel &) = delete;
+
+  uint64_t now() const { return now_; }
+
+  // Schedules or reschedules t. A deadline that is not in the future fires
+  // on the next tick.
+  void schedule(timer &t, uint64_t deadline) {
+    if (t.scheduled()) t.hook_.unlink();
+    t.deadline_ = deadline > now_ ? deadline : now_ + 1;
+    Place_(t);
+  }
+  void schedule_after(timer &t, uint64_t delay) { schedule(t, now_ + delay); }
+  void cancel(timer &t) {
+    if (t.scheduled()) t.hook_.unlink();
+  }
+
+  // Moves the clock to `now` and calls fn(timer &) for every timer whose
+  // deadline passed, in deadline order. The timers are unscheduled before
+  // fn sees them, so fn may reschedule, cancel or destroy any timer.
+  // Returns how many timers fired.
+  template <typename Fn>
+  size_type advance(uint64_t now, Fn &&fn);
+
+  // O(number of slots).
+  bool empty() const;
+
+ private:
+  using timer_list = intrusive_list<timer, auto_unlink_hook, &timer::hook_>;
+
+  static constexpr int kLevels_ = 4;
+  static constexpr int kSlotBits_ = 6;
+  static constexpr uint64_t kSlots_ = uint64_t(1) << kSlotBits_;
+  static constexpr uint64_t kHorizon_ = uint64_t(1)
+                                        << (kSlotBits_ * kLevels_);
+
+  uint64_t now_;
+  // Bit i is set while level 0 slot i may be non-empty, so advance() can
+  // jump over runs of empty ticks. Cancelled timers leave stale bits, which
+  // only cost a wasted stop.
+  uint64_t occupied_;
+  timer_list slots_[kLevels_][kSlots_];
+  timer_list overflow_;
+
+  static uint64_t SlotOf_(uint64_t deadline, int level) {
+    return (deadline >> (kSlotBits_ * level)) & (kSlots_ - 1);
+  }
+
+  // Files t by its distance from now_; a deadline equal to now_ goes to
+  // the level 0 slot that is about to fire.
+  void Place_(timer &t) {
+    uint64_t delta = t.deadline_ - now_;
+    if (delta >= kHorizon_) {
+      overflow_.push_back(t);
+      return;
+    }
+    int level = 0;
+    while (delta >= uint64_t(1) << (kSlotBits_ * (level + 1))) ++level;
+    uint64_t slot = SlotOf_(t.deadline_, level);
+    if (level == 0) occupied_ |= uint64_t(1) << slot;
+    slots_[level][slot].push_back(t);
+  }
+
+  // Redistributes a slot (or the overflow list) after the clock moved.
+  void Cascade_(timer_list &list) {
+    timer_list pending;
+    pending.splice(pending.end(), list);
+    while (!pending.empty()) {
+      timer &t = pending.front();
+      pending.pop_front();
+      Place_(t);
+    }
+  }
+};
+
+template <typename Fn>
+timer_wheel::size_type timer_wheel::advance(uint64_t now, Fn &&fn) {
+  size_type fired = 0;
+  timer_list expired;
+  while (now_ < now) {
+    // Up to the next multiple of 64 only level 0 slots can have work.
+    uint64_t next = (now_ | (kSlots_ - 1)) + 1;
+    uint64_t ahead = occupied_ & ~((uint64_t(2) << SlotOf_(now_, 0)) - 1);
+    if (ahead) next = (now_ & ~(kSlots_ - 1)) + __builtin_ctzll(ahead);
+    if (next > now) {
+      now_ = now;
+      break;
+    }
+    now_ = next;
+    // Higher levels first: their timers may land in the slot that fires
+    // now.
+    if ((now_ & (kHorizon_ - 1)) == 0) Cascade_(overflow_);
+    for (int level = kLevels_ - 1; level > 0; --level) {
+      if ((now_ & ((uint64_t(1) << (kSlotBits_ * level)) - 1)) == 0)
+        Cascade_(slots_[level][SlotOf_(now_, level)]);
+    }
+    expired.splice(expired.end(), slots_[0][SlotOf_(now_, 0)]);
+    occupied_ &= ~(uint64_t(1) << SlotOf_(now_, 0));
+    while (!expired.empty()) {
+      timer &t = expired.front();
+      expired.pop_front();
+      ++fired;
+      fn(t);
+    }
+  }
+  return fired;
+}
+
+inline bool timer_wheel::empty() const {
+  for (const auto &level : slots_)
+    for (const timer_list &slot : level)
+      if (!slot.empty()) return false;
+  return overflow_.empty();
+}
+}  // namespace s21
+
+#endif
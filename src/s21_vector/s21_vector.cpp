@@ -44,7 +44,7 @@ vector<T> &vector<T>::operator=(vector<T> &&other) noexcept {
 }
 
 template <typename T>
-T vector<T>::at(size_type i) {
+typename vector<T>::reference vector<T>::at(size_type i) {
   if (i >= m_size) {
     throw std::out_of_range("Index out of range");
   }
@@ -52,12 +52,20 @@ T vector<T>::at(size_type i) {
 }
 
 template <typename T>
-T vector<T>::operator[](size_type i) {
+typename vector<T>::const_reference vector<T>::at(size_type i) const {
+  if (i >= m_size) {
+    throw std::out_of_range("Index out of range");
+  }
+  return arr[i];
+}
+
+template <typename T>
+typename vector<T>::reference vector<T>::operator[](size_type i) {
   return arr[i];
 }
 
 template <typename T>
-T vector<T>::operator[](size_type i) const {
+typename vector<T>::const_reference vector<T>::operator[](size_type i) const {
   return arr[i];
 }
 
@@ -66,7 +74,7 @@ void vector<T>::push_back(T v) {
   if (m_size == m_capacity) {
     reserve_more_capacity(m_capacity == 0 ? 1 : m_capacity * 2);
   }
-  arr[m_size++] = v;
+  arr[m_size++] = std::move(v);
 }
 
 template <typename T>
@@ -36,7 +36,7 @@ class vector {
   vector(std::initializer_list<value_type> const &items);
   // copy constructor with simplified syntax
   vector(const vector &v)
-      : m_size(v.m_size), m_capacity(v.m_capacity), arr(new T[v.m_size]) {
+      : m_size(v.m_size), m_capacity(v.m_size), arr(new T[v.m_size]) {
     std::copy(v.arr, v.arr + v.m_size, arr);
   };
   // move constructor with simplified syntax
@@ -57,11 +57,15 @@ class vector {
   size_type size() { return m_size; }
   size_type size() const { return m_size; }
   bool empty() { return m_size == 0; }
+  bool empty() const { return m_size == 0; }
+  size_type capacity() const { return m_capacity; }
+  void reserve(size_type size) { reserve_more_capacity(size); }
 
   // element accessor
-  value_type at(size_type i);
-  value_type operator[](size_type i);
-  value_type operator[](size_type i) const;
+  reference at(size_type i);
+  const_reference at(size_type i) const;
+  reference operator[](size_type i);
+  const_reference operator[](size_type i) const;
 
   // append new element
   void push_back(value_type v);
@@ -0,0 +1,82 @@
+#ifndef S21_WINDOW_AGGREGATOR_H_
+#define S21_WINDOW_AGGREGATOR_H_
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+// FIFO window that folds its elements with any associative Op, oldest
+// first, in amortized O(1) per push and pop (two-stack aggregation). The
+// back stack takes pushes and keeps one running aggregate; when the front
+// stack runs dry, the back stack is flipped onto it with suffix aggregates,
+// so pops only drop the top. Op need not be commutative or invertible, so
+// min, max, gcd or a struct of sum and sum of squares all work.
+//
+// T must be default constructible, like every s21::vector element.
+template <typename T, typename Op = std::plus<T>>
+class window_aggregator {
+ public:
+  using value_type = T;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  explicit window_aggregator(const Op &op = Op()) : op_(op) {}
+
+  bool empty() const { return size() == 0; }
+  size_type size() const { return front_.size() + back_.size(); }
+
+  void push(const_reference value);
+  // Removes the oldest element.
+  void pop();
+  // op(...op(op(oldest, next), next)..., newest).
+  value_type query() const;
+
+ private:
+  // Oldest element on top; each entry folds itself and everything newer
+  // in this stack.
+  vector<T> front_;
+  // Newest element on top.
+  vector<T> back_;
+  T back_sum_;
+  Op op_;
+
+  void Flip_();
+};
+
+template <typename T, typename Op>
+void window_aggregator<T, Op>::push(const_reference value) {
+  back_sum_ = back_.empty() ? value : op_(back_sum_, value);
+  back_.push_back(value);
+}
+
+template <typename T, typename Op>
+void window_aggregator<T, Op>::pop() {
+  if (empty()) throw std::out_of_range("Window is empty");
+  if (front_.empty()) Flip_();
+  front_.pop_back();
+}
+
+template <typename T, typename Op>
+typename window_aggregator<T, Op>::value_type
+window_aggregator<T, Op>::query() const {
+  if (empty()) throw std::out_of_range("Window is empty");
+  if (back_.empty()) return front_.back();
+  if (front_.empty()) return back_sum_;
+  return op_(front_.back(), back_sum_);
+}
+
+template <typename T, typename Op>
+void window_aggregator<T, Op>::Flip_() {
+  while (!back_.empty()) {
+    T value = std::move(back_.back());
+    back_.pop_back();
+    front_.push_back(front_.empty() ? std::move(value)
+                                    : op_(value, front_.back()));
+  }
+}
+}  // namespace s21
+
+#endif
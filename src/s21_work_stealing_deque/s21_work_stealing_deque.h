@@ -0,0 +1,139 @@
+#ifndef S21_WORK_STEALING_DEQUE_H_
+#define S21_WORK_STEALING_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+#include "../s21_vector/s21_vector.h"
+
+namespace s21 {
+// Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+// bottom (LIFO) without contention; any number of thieves take from the
+// top (FIFO) with a CAS, which only races with the owner for the last
+// element. The ring grows on demand; outgrown rings are kept until the
+// deque dies, because a thief may still be reading one.
+//
+// T must be trivially copyable (typically a pointer to a task).
+template <typename T>
+class work_stealing_deque {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "work_stealing_deque needs a trivially copyable T");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+
+  explicit work_stealing_deque(size_type capacity = 64);
+  work_stealing_deque(const work_stealing_deque &) = delete;
+  work_stealing_deque &operator=(const work_stealing_deque &) = delete;
+
+  // Owner only.
+  void push(T value);
+  bool try_pop(T &out);
+  // Any thread. Fails when empty or when it lost a race; a thief then
+  // simply moves on to another victim.
+  bool try_steal(T &out);
+
+  // Only a snapshot while other threads are stealing.
+  bool empty() const {
+    return bottom_.load(std::memory_order_relaxed) <=
+           top_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  static constexpr size_type kCacheLine_ = 64;
+
+  struct Ring_ {
+    explicit Ring_(int64_t capacity)
+        : mask_(capacity - 1), slots_(new std::atomic<T>[capacity]) {}
+    int64_t Capacity_() const { return mask_ + 1; }
+    T Get_(int64_t i) const {
+      return slots_[i & mask_].load(std::memory_order_relaxed);
+    }
+    void Put_(int64_t i, T value) {
+      slots_[i & mask_].store(value, std::memory_order_relaxed);
+    }
+
+    int64_t mask_;
+    std::unique_ptr<std::atomic<T>[]> slots_;
+  };
+
+  // Sequentially consistent top_/bottom_ accesses stand in for the
+  // fences of the published algorithm.
+  alignas(kCacheLine_) std::atomic<int64_t> top_;
+  alignas(kCacheLine_) std::atomic<int64_t> bottom_;
+  std::atomic<Ring_ *> ring_;
+  // Every ring ever used, current one last; touched by the owner only.
+  s21::vector<std::unique_ptr<Ring_>> rings_;
+
+  Ring_ *Grow_(Ring_ *ring, int64_t top, int64_t bottom);
+};
+
+template <typename T>
+work_stealing_deque<T>::work_stealing_deque(size_type capacity)
+    : top_(0), bottom_(0) {
+  int64_t size = 2;
+  while (static_cast<size_type>(size) < capacity) size *= 2;
+  rings_.push_back(std::make_unique<Ring_>(size));
+  ring_.store(rings_.back().get(), std::memory_order_relaxed);
+}
+
+template <typename T>
+void work_stealing_deque<T>::push(T value) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed);
+  int64_t top = top_.load(std::memory_order_acquire);
+  Ring_ *ring = ring_.load(std::memory_order_relaxed);
+  if (bottom - top >= ring->Capacity_()) ring = Grow_(ring, top, bottom);
+  ring->Put_(bottom, value);
+  bottom_.store(bottom + 1, std::memory_order_seq_cst);
+}
+
+template <typename T>
+bool work_stealing_deque<T>::try_pop(T &out) {
+  int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+  Ring_ *ring = ring_.load(std::memory_order_relaxed);
+  bottom_.store(bottom, std::memory_order_seq_cst);
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  if (top > bottom) {
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return false;
+  }
+  out = ring->Get_(bottom);
+  if (top == bottom) {
+    // Last element: race the thieves for it.
+    bool won = top_.compare_exchange_strong(
+        top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    bottom_.store(bottom + 1, std::memory_order_relaxed);
+    return won;
+  }
+  return true;
+}
+
+template <typename T>
+bool work_stealing_deque<T>::try_steal(T &out) {
+  int64_t top = top_.load(std::memory_order_seq_cst);
+  int64_t bottom = bottom_.load(std::memory_order_seq_cst);
+  if (top >= bottom) return false;
+  Ring_ *ring = ring_.load(std::memory_order_acquire);
+  T value = ring->Get_(top);
+  if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                    std::memory_order_relaxed))
+    return false;
+  out = value;
+  return true;
+}
+
+template <typename T>
+typename work_stealing_deque<T>::Ring_ *work_stealing_deque<T>::Grow_(
+    Ring_ *ring, int64_t top, int64_t bottom) {
+  rings_.push_back(std::make_unique<Ring_>(ring->Capacity_() * 2));
+  Ring_ *bigger = rings_.back().get();
+  for (int64_t i = top; i < bottom; ++i) bigger->Put_(i, ring->Get_(i));
+  ring_.store(bigger, std::memory_order_release);
+  return bigger;
+}
+}  // namespace s21
+
+#endif
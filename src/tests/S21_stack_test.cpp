@@ -1,4 +1,6 @@
 #include "../s21_stack/s21_stack.h"
+#include "../s21_chunk_list/s21_chunk_list.h"
+#include "../s21_deque/s21_deque.h"
 
 #include <gtest/gtest.h>
 
@@ -144,4 +146,38 @@ TEST(Stack, Swap) {
   std_stack_empty.swap(std_stack_int);
   EXPECT_EQ(our_stack_empty.top(), std_stack_empty.top());
   EXPECT_EQ(our_stack_int.empty(), std_stack_int.empty());
-}
\ No newline at end of file
+}
+TEST(Stack, DequeContainer) {
+  s21::stack<std::string, s21::deque<std::string>> our_stack = {"a", "b"};
+  std::stack<std::string> std_stack;
+  std_stack.push("a");
+  std_stack.push("b");
+  for (int i = 0; i < 100; ++i) {
+    our_stack.push(std::to_string(i));
+    std_stack.push(std::to_string(i));
+  }
+  while (!std_stack.empty()) {
+    EXPECT_EQ(our_stack.top(), std_stack.top());
+    our_stack.pop();
+    std_stack.pop();
+  }
+  EXPECT_TRUE(our_stack.empty());
+}
+
+TEST(Stack, ChunkListContainer) {
+  s21::stack<int, s21::chunk_list<int>> our_stack = {1, 2};
+  std::stack<int> std_stack;
+  std_stack.push(1);
+  std_stack.push(2);
+  for (int i = 0; i < 5000; ++i) {
+    our_stack.push(i);
+    std_stack.push(i);
+  }
+  EXPECT_EQ(our_stack.size(), std_stack.size());
+  while (!std_stack.empty()) {
+    EXPECT_EQ(our_stack.top(), std_stack.top());
+    our_stack.pop();
+    std_stack.pop();
+  }
+  EXPECT_TRUE(our_stack.empty());
+}
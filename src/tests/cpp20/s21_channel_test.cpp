@@ -0,0 +1,146 @@
+#include "../../s21_channel/s21_channel.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+s21::task Produce(s21::channel<int> &ch, int from, int to, bool close) {
+  for (int i = from; i < to; ++i) co_await ch.send(i);
+  if (close) ch.close();
+}
+
+s21::task Collect(s21::channel<int> &ch, std::vector<int> &out) {
+  while (auto value = co_await ch.recv()) out.push_back(*value);
+}
+
+s21::task Forward(s21::channel<int> &in, s21::channel<int> &out) {
+  while (auto value = co_await in.recv()) co_await out.send(*value + 1);
+  out.close();
+}
+
+s21::task Sum(s21::channel<int> &ch, std::atomic<long> &sum) {
+  while (auto value = co_await ch.recv()) sum += *value;
+}
+}  // namespace
+
+TEST(ChannelTest, UnboundedNeverSuspendsSender) {
+  s21::single_thread_executor executor;
+  s21::channel<int> ch;
+  std::vector<int> out;
+  executor.spawn(Produce(ch, 0, 100, true));
+  EXPECT_EQ(executor.run(), 0U);
+  EXPECT_EQ(ch.size(), 100U);
+  executor.spawn(Collect(ch, out));
+  EXPECT_EQ(executor.run(), 0U);
+  ASSERT_EQ(out.size(), 100U);
+  for (int i = 0; i < 100; ++i) EXPECT_EQ(out[i], i);
+}
+
+TEST(ChannelTest, BoundedSuspendsSender) {
+  s21::single_thread_executor executor;
+  s21::channel<int> ch(2);
+  std::vector<int> out;
+  executor.spawn(Produce(ch, 0, 10, true));
+  EXPECT_EQ(executor.run(), 1U);
+  EXPECT_EQ(ch.size(), 2U);
+  executor.spawn(Collect(ch, out));
+  EXPECT_EQ(executor.run(), 0U);
+  EXPECT_EQ(out, std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+TEST(ChannelTest, RendezvousHandsOverDirectly) {
+  s21::single_thread_executor executor;
+  s21::channel<int> ch(0);
+  std::vector<int> out;
+  executor.spawn(Collect(ch, out));
+  executor.spawn(Produce(ch, 0, 5, true));
+  EXPECT_EQ(executor.run(), 0U);
+  EXPECT_EQ(ch.size(), 0U);
+  EXPECT_EQ(out, std::vector<int>({0, 1, 2, 3, 4}));
+}
+
+TEST(ChannelTest, CloseFailsSendersAndWakesReceivers) {
+  s21::single_thread_executor executor;
+  s21::channel<std::string> ch(1);
+  bool first = false;
+  bool second = true;
+  std::optional<std::string> received = "unset";
+  auto sender = [&]() -> s21::task {
+    first = co_await ch.send("kept");
+    second = co_await ch.send("dropped");
+  };
+  executor.spawn(sender());
+  EXPECT_EQ(executor.run(), 1U);
+  ch.close();
+  EXPECT_EQ(executor.run(), 0U);
+  EXPECT_TRUE(first);
+  EXPECT_FALSE(second);
+  auto receiver = [&]() -> s21::task {
+    received = co_await ch.recv();
+    EXPECT_EQ(*received, "kept");
+    received = co_await ch.recv();
+  };
+  executor.spawn(receiver());
+  EXPECT_EQ(executor.run(), 0U);
+  EXPECT_FALSE(received.has_value());
+  EXPECT_TRUE(ch.closed());
+}
+
+TEST(ChannelTest, TaskExceptionReachesRun) {
+  s21::single_thread_executor executor;
+  s21::channel<int> ch;
+  auto failing = [&]() -> s21::task {
+    co_await ch.recv();
+    throw std::runtime_error("stage failed");
+  };
+  executor.spawn(failing());
+  EXPECT_EQ(executor.run(), 1U);
+  ch.close();
+  EXPECT_THROW(executor.run(), std::runtime_error);
+}
+
+TEST(ChannelTest, PipelineOnThreadPool) {
+  constexpr int kStages = 1000;
+  constexpr int kValues = 200;
+  s21::thread_pool_executor pool(4);
+  std::vector<std::unique_ptr<s21::channel<int>>> links;
+  for (int i = 0; i <= kStages; ++i)
+    links.push_back(std::make_unique<s21::channel<int>>(4));
+  std::atomic<long> sum{0};
+  pool.spawn(Sum(*links[kStages], sum));
+  for (int i = 0; i < kStages; ++i)
+    pool.spawn(Forward(*links[i], *links[i + 1]));
+  pool.spawn(Produce(*links[0], 0, kValues, true));
+  pool.wait();
+  EXPECT_EQ(sum.load(), kValues * (kValues - 1) / 2 + kValues * kStages);
+}
+
+TEST(ChannelTest, FanInAcrossExecutors) {
+  s21::thread_pool_executor pool(2);
+  s21::single_thread_executor local;
+  s21::channel<int> ch(8);
+  std::vector<int> out;
+  local.spawn(Collect(ch, out));
+  for (int p = 0; p < 4; ++p)
+    pool.spawn(Produce(ch, p * 100, p * 100 + 100, false));
+  // The collector is resumed on this thread whenever a producer wakes it.
+  while (out.size() < 400) {
+    local.run();
+    std::this_thread::yield();
+  }
+  pool.wait();
+  ch.close();
+  EXPECT_EQ(local.run(), 0U);
+  EXPECT_EQ(out.size(), 400U);
+}
+
+int main(int argc, char **argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
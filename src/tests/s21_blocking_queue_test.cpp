@@ -0,0 +1,119 @@
+#include "../s21_blocking_queue/s21_blocking_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(BlockingQueueTest, TryPushAndPop) {
+  s21::blocking_queue<std::string> q(2);
+  std::string out;
+  EXPECT_EQ(q.capacity(), 2U);
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.push(std::string("b")));
+  EXPECT_FALSE(q.try_push("c"));
+  EXPECT_EQ(q.size(), 2U);
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_THROW(s21::blocking_queue<int>(0), std::length_error);
+}
+
+TEST(BlockingQueueTest, PopWaitTimesOut) {
+  s21::blocking_queue<int> q(4);
+  int out = 0;
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(q.pop_wait(out, 20ms));
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+  q.push(5);
+  EXPECT_TRUE(q.pop_wait(out, 0ms));
+  EXPECT_EQ(out, 5);
+}
+
+TEST(BlockingQueueTest, ProducerBlocksUntilSpaceFrees) {
+  s21::blocking_queue<int> q(1);
+  q.push(1);
+  std::atomic<bool> pushed{false};
+  std::thread producer([&] {
+    q.push(2);
+    pushed = true;
+  });
+  std::this_thread::sleep_for(20ms);
+  EXPECT_FALSE(pushed.load());
+  int out;
+  EXPECT_TRUE(q.pop(out));
+  producer.join();
+  EXPECT_TRUE(pushed.load());
+  EXPECT_TRUE(q.pop(out));
+  EXPECT_EQ(out, 2);
+}
+
+TEST(BlockingQueueTest, BulkTransfer) {
+  s21::blocking_queue<int> q(8);
+  int src[5] = {1, 2, 3, 4, 5};
+  EXPECT_EQ(q.push_bulk(src, 5), 5U);
+  std::vector<int> out;
+  EXPECT_EQ(q.pop_bulk(std::back_inserter(out), 3), 3U);
+  EXPECT_EQ(q.pop_bulk(std::back_inserter(out), 10), 2U);
+  EXPECT_EQ(out, std::vector<int>({1, 2, 3, 4, 5}));
+}
+
+TEST(BlockingQueueTest, CloseWakesWaitersAndDrains) {
+  s21::blocking_queue<int> q(2);
+  std::thread consumer([&] {
+    int out;
+    EXPECT_TRUE(q.pop(out));
+    EXPECT_EQ(out, 1);
+    EXPECT_TRUE(q.pop(out));
+    EXPECT_FALSE(q.pop(out));
+  });
+  q.push(1);
+  q.push(2);
+  q.close();
+  consumer.join();
+  EXPECT_TRUE(q.closed());
+  EXPECT_FALSE(q.push(3));
+  int buf[2];
+  EXPECT_EQ(q.pop_bulk(buf, 2), 0U);
+}
+
+TEST(BlockingQueueTest, Pipeline) {
+  constexpr int kProducers = 3;
+  constexpr int kPerProducer = 10000;
+  s21::blocking_queue<int> q(16);
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  std::vector<std::thread> producers;
+  for (int p = 0; p < kProducers; ++p) {
+    producers.emplace_back([&q, p] {
+      for (int i = 0; i < kPerProducer; i += 4) {
+        int batch[4];
+        for (int k = 0; k < 4; ++k) batch[k] = p * kPerProducer + i + k;
+        if (i % 8 == 0) {
+          q.push_bulk(batch, 4);
+        } else {
+          for (int value : batch) q.push(value);
+        }
+      }
+    });
+  }
+  std::vector<std::thread> consumers;
+  for (int c = 0; c < 2; ++c) {
+    consumers.emplace_back([&] {
+      int buf[8];
+      while (size_t n = q.pop_bulk(buf, 8))
+        for (size_t i = 0; i < n; ++i) seen[buf[i]].fetch_add(1);
+    });
+  }
+  for (auto &t : producers) t.join();
+  q.close();
+  for (auto &t : consumers) t.join();
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+}
@@ -0,0 +1,110 @@
+#include "../s21_buffer_queue/s21_buffer_queue.h"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <system_error>
+
+namespace {
+std::string ReadAll(int fd) {
+  std::string out;
+  char chunk[4096];
+  ssize_t n;
+  while ((n = ::read(fd, chunk, sizeof(chunk))) > 0) out.append(chunk, n);
+  return out;
+}
+
+struct Pipe {
+  Pipe() {
+    if (::pipe(fds) != 0) std::abort();
+  }
+  ~Pipe() {
+    ::close(fds[0]);
+    ::close(fds[1]);
+  }
+  void NonBlocking() {
+    for (int fd : fds) ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+  }
+  int fds[2];
+};
+}  // namespace
+
+TEST(BufferQueueTest, DrainsToPipeInOrder) {
+  s21::buffer_queue q;
+  EXPECT_TRUE(q.empty());
+  q.push("hello, ");
+  q.push(std::string());
+  q.push("gather", 6);
+  q.push(std::string(" world"));
+  EXPECT_EQ(q.size(), 3U);
+  EXPECT_EQ(q.bytes(), 19U);
+  Pipe p;
+  EXPECT_EQ(q.drain_to(p.fds[1]), 19U);
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.size(), 0U);
+  ::close(p.fds[1]);
+  p.fds[1] = -1;  // Lets ReadAll stop at end of file.
+  EXPECT_EQ(ReadAll(p.fds[0]), "hello, gather world");
+}
+
+TEST(BufferQueueTest, ResumesInsideBufferAfterShortWrite) {
+  Pipe p;
+  p.NonBlocking();
+  s21::buffer_queue q;
+  std::string expected;
+  for (int i = 0; i < 64; ++i) {
+    std::string buffer(3001 + i, static_cast<char>('a' + i % 26));
+    expected += buffer;
+    q.push(std::move(buffer));
+  }
+  std::string received;
+  size_t rounds = 0;
+  while (!q.empty()) {
+    size_t before = q.bytes();
+    size_t written = q.drain_to(p.fds[1]);
+    EXPECT_EQ(q.bytes(), before - written);
+    received += ReadAll(p.fds[0]);
+    ++rounds;
+  }
+  EXPECT_GT(rounds, 1U);  // The pipe holds less than the whole queue.
+  EXPECT_EQ(received, expected);
+  EXPECT_EQ(q.drain_to(p.fds[1]), 0U);
+}
+
+TEST(BufferQueueTest, WritesManyBuffersToFile) {
+  char path[] = "/tmp/s21_buffer_queue_XXXXXX";
+  int fd = ::mkstemp(path);
+  ASSERT_GE(fd, 0);
+  s21::buffer_queue q;
+  std::string expected;
+  for (int i = 0; i < 5000; ++i) {  // More than IOV_MAX buffers.
+    std::string line = std::to_string(i) + "\n";
+    expected += line;
+    q.push(line);
+  }
+  EXPECT_EQ(q.drain_to(fd), expected.size());
+  EXPECT_TRUE(q.empty());
+  ::lseek(fd, 0, SEEK_SET);
+  EXPECT_EQ(ReadAll(fd), expected);
+  ::close(fd);
+  ::unlink(path);
+}
+
+TEST(BufferQueueTest, ErrorsThrowAndKeepData) {
+  s21::buffer_queue q;
+  q.push("kept");
+  try {
+    q.drain_to(-1);
+    FAIL();
+  } catch (const std::system_error &e) {
+    EXPECT_EQ(e.code().value(), EBADF);
+  }
+  EXPECT_EQ(q.bytes(), 4U);
+  q.clear();
+  EXPECT_TRUE(q.empty());
+  EXPECT_EQ(q.drain_to(-1), 0U);  // Nothing to write, no syscall.
+}
@@ -0,0 +1,90 @@
+#include "../s21_chunk_list/s21_chunk_list.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(ChunkListTest, PushPopAcrossChunks) {
+  s21::chunk_list<int> list;
+  EXPECT_TRUE(list.empty());
+  EXPECT_THROW(list.back(), std::out_of_range);
+  EXPECT_THROW(list.pop_back(), std::out_of_range);
+  for (int i = 0; i < 10000; ++i) {
+    list.push_back(i);
+    EXPECT_EQ(list.back(), i);
+  }
+  EXPECT_EQ(list.size(), 10000U);
+  for (int i = 9999; i >= 0; --i) {
+    EXPECT_EQ(list.back(), i);
+    list.pop_back();
+  }
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(ChunkListTest, ReferencesStayValid) {
+  s21::chunk_list<std::string> list;
+  std::vector<std::string *> where;
+  for (int i = 0; i < 3000; ++i)
+    where.push_back(&list.emplace_back(std::to_string(i)));
+  for (int i = 0; i < 3000; ++i) EXPECT_EQ(*where[i], std::to_string(i));
+  for (int i = 0; i < 1000; ++i) list.pop_back();
+  for (int i = 0; i < 1000; ++i) list.push_back("x");
+  for (int i = 0; i < 2000; ++i) EXPECT_EQ(*where[i], std::to_string(i));
+}
+
+TEST(ChunkListTest, CopyMoveAndSwap) {
+  s21::chunk_list<int> a = {1, 2, 3};
+  for (int i = 4; i <= 2000; ++i) a.push_back(i);
+  s21::chunk_list<int> b(a);
+  s21::chunk_list<int> c;
+  c = a;
+  s21::chunk_list<int> d(std::move(a));
+  EXPECT_TRUE(a.empty());
+  s21::chunk_list<int> e = {7};
+  e.swap(d);
+  EXPECT_EQ(d.back(), 7);
+  for (int i = 2000; i >= 1; --i) {
+    ASSERT_EQ(b.back(), i);
+    ASSERT_EQ(c.back(), i);
+    ASSERT_EQ(e.back(), i);
+    b.pop_back();
+    c.pop_back();
+    e.pop_back();
+  }
+  EXPECT_TRUE(b.empty());
+  EXPECT_TRUE(c.empty());
+  EXPECT_TRUE(e.empty());
+}
+
+TEST(ChunkListTest, DestroysElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::chunk_list<std::shared_ptr<int>> list;
+    for (int i = 0; i < 1500; ++i) list.push_back(counter);
+    for (int i = 0; i < 500; ++i) list.pop_back();
+    EXPECT_EQ(counter.use_count(), 1001);
+    list.clear();
+    EXPECT_EQ(counter.use_count(), 1);
+    for (int i = 0; i < 10; ++i) list.push_back(counter);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(ChunkListTest, ThrowingConstructorLeavesListIntact) {
+  struct Fragile {
+    explicit Fragile(int v) : value(v) {
+      if (v < 0) throw std::invalid_argument("negative");
+    }
+    int value;
+  };
+  s21::chunk_list<Fragile> list;
+  for (int i = 0; i < 1024; ++i) list.emplace_back(i);
+  EXPECT_THROW(list.emplace_back(-1), std::invalid_argument);
+  EXPECT_EQ(list.size(), 1024U);
+  EXPECT_EQ(list.back().value, 1023);
+  list.emplace_back(5);
+  EXPECT_EQ(list.back().value, 5);
+}
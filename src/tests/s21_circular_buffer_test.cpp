@@ -0,0 +1,112 @@
+#include "../s21_circular_buffer/s21_circular_buffer.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "../s21_queue/s21_queue.h"
+
+TEST(CircularBufferTest, DefaultConstructor) {
+  s21::circular_buffer<int> buf;
+  EXPECT_TRUE(buf.empty());
+  EXPECT_TRUE(buf.full());
+  EXPECT_EQ(buf.capacity(), 0U);
+  EXPECT_THROW(buf.push_back(1), std::length_error);
+  EXPECT_THROW(buf.front(), std::out_of_range);
+}
+
+TEST(CircularBufferTest, InitializerList) {
+  s21::circular_buffer<int> buf = {1, 2, 3};
+  EXPECT_EQ(buf.size(), 3U);
+  EXPECT_EQ(buf.capacity(), 3U);
+  EXPECT_TRUE(buf.full());
+  EXPECT_EQ(buf.front(), 1);
+  EXPECT_EQ(buf.back(), 3);
+}
+
+TEST(CircularBufferTest, OverwriteOldest) {
+  s21::circular_buffer<int> buf(4);
+  for (int i = 0; i < 10; ++i) buf.push_back(i);
+  EXPECT_EQ(buf.size(), 4U);
+  EXPECT_EQ(buf.front(), 6);
+  EXPECT_EQ(buf.back(), 9);
+  for (size_t i = 0; i < buf.size(); ++i) EXPECT_EQ(buf[i], 6 + (int)i);
+  EXPECT_EQ(buf.at(3), 9);
+  EXPECT_THROW(buf.at(4), std::out_of_range);
+}
+
+TEST(CircularBufferTest, RejectPolicy) {
+  s21::circular_buffer<int> buf(2, s21::overflow_policy::reject);
+  buf.push_back(1);
+  buf.push_back(2);
+  EXPECT_THROW(buf.push_back(3), std::length_error);
+  buf.pop_front();
+  buf.push_back(3);
+  EXPECT_EQ(buf.front(), 2);
+  EXPECT_EQ(buf.back(), 3);
+}
+
+TEST(CircularBufferTest, Segments) {
+  s21::circular_buffer<int> buf(5);
+  for (int i = 0; i < 7; ++i) buf.push_back(i);
+  auto one = buf.array_one();
+  auto two = buf.array_two();
+  EXPECT_EQ(one.second + two.second, 5U);
+  std::vector<int> out(one.first, one.first + one.second);
+  out.insert(out.end(), two.first, two.first + two.second);
+  EXPECT_EQ(out, (std::vector<int>{2, 3, 4, 5, 6}));
+
+  buf.clear();
+  buf.push_back(42);
+  EXPECT_EQ(buf.array_one().second, 1U);
+  EXPECT_EQ(buf.array_two().second, 0U);
+}
+
+TEST(CircularBufferTest, PopAndIterate) {
+  s21::circular_buffer<std::string> buf(3);
+  buf.push_back("a");
+  buf.push_back("b");
+  buf.push_back("c");
+  buf.push_back("d");
+  buf.pop_back();
+  std::string joined;
+  for (auto it = buf.begin(); it != buf.end(); ++it) joined += *it;
+  EXPECT_EQ(joined, "bc");
+  buf.pop_front();
+  EXPECT_EQ(buf.front(), "c");
+  buf.pop_front();
+  EXPECT_THROW(buf.pop_front(), std::out_of_range);
+}
+
+TEST(CircularBufferTest, CopyMoveAndCapacity) {
+  s21::circular_buffer<int> buf(3);
+  for (int i = 0; i < 5; ++i) buf.push_back(i);
+  s21::circular_buffer<int> copy(buf);
+  s21::circular_buffer<int> moved(std::move(buf));
+  EXPECT_EQ(copy.front(), 2);
+  EXPECT_EQ(moved.back(), 4);
+  EXPECT_EQ(buf.capacity(), 0U);
+
+  moved.set_capacity(2);
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_EQ(moved.front(), 3);
+  moved.set_capacity(5);
+  moved.push_back(5);
+  EXPECT_EQ(moved.size(), 3U);
+  EXPECT_EQ(moved.front(), 3);
+  copy = moved;
+  EXPECT_EQ(copy.capacity(), 5U);
+  EXPECT_EQ(copy.back(), 5);
+}
+
+TEST(CircularBufferTest, QueueContainer) {
+  s21::queue<int, s21::circular_buffer<int>> window(
+      s21::circular_buffer<int>(3));
+  for (int i = 0; i < 10; ++i) window.push(i);
+  EXPECT_EQ(window.size(), 3U);
+  EXPECT_EQ(window.front(), 7);
+  EXPECT_EQ(window.back(), 9);
+  window.pop();
+  EXPECT_EQ(window.front(), 8);
+}
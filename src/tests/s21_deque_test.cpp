@@ -0,0 +1,117 @@
+#include "../s21_deque/s21_deque.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <string>
+
+TEST(DequeTest, DefaultConstructor) {
+  s21::deque<int> our_deque;
+  EXPECT_TRUE(our_deque.empty());
+  EXPECT_EQ(our_deque.size(), 0U);
+  EXPECT_THROW(our_deque.front(), std::out_of_range);
+  EXPECT_THROW(our_deque.back(), std::out_of_range);
+  EXPECT_THROW(our_deque.pop_front(), std::out_of_range);
+}
+
+TEST(DequeTest, InitializerListAndAccess) {
+  s21::deque<int> our_deque = {1, 2, 3, 4};
+  EXPECT_EQ(our_deque.size(), 4U);
+  EXPECT_EQ(our_deque.front(), 1);
+  EXPECT_EQ(our_deque.back(), 4);
+  EXPECT_EQ(our_deque[2], 3);
+  EXPECT_EQ(our_deque.at(1), 2);
+  EXPECT_THROW(our_deque.at(4), std::out_of_range);
+}
+
+TEST(DequeTest, PushBothEnds) {
+  s21::deque<int> our_deque;
+  std::deque<int> std_deque;
+  for (int i = 0; i < 5000; ++i) {
+    if (i % 2) {
+      our_deque.push_back(i);
+      std_deque.push_back(i);
+    } else {
+      our_deque.push_front(i);
+      std_deque.push_front(i);
+    }
+  }
+  ASSERT_EQ(our_deque.size(), std_deque.size());
+  for (size_t i = 0; i < std_deque.size(); ++i)
+    EXPECT_EQ(our_deque[i], std_deque[i]);
+}
+
+TEST(DequeTest, PopBothEnds) {
+  s21::deque<std::string> our_deque;
+  std::deque<std::string> std_deque;
+  for (int i = 0; i < 3000; ++i) {
+    our_deque.push_back(std::to_string(i));
+    std_deque.push_back(std::to_string(i));
+  }
+  while (!std_deque.empty()) {
+    EXPECT_EQ(our_deque.front(), std_deque.front());
+    EXPECT_EQ(our_deque.back(), std_deque.back());
+    our_deque.pop_front();
+    std_deque.pop_front();
+    if (!std_deque.empty()) {
+      our_deque.pop_back();
+      std_deque.pop_back();
+    }
+  }
+  EXPECT_TRUE(our_deque.empty());
+  our_deque.push_front("x");
+  EXPECT_EQ(our_deque.back(), "x");
+}
+
+TEST(DequeTest, ReferencesStayValid) {
+  s21::deque<int> our_deque = {42};
+  int *first = &our_deque.front();
+  for (int i = 0; i < 10000; ++i) {
+    our_deque.push_back(i);
+    our_deque.push_front(i);
+  }
+  EXPECT_EQ(first, &our_deque[10000]);
+  EXPECT_EQ(*first, 42);
+}
+
+TEST(DequeTest, CopyAndMove) {
+  s21::deque<int> our_deque;
+  for (int i = 0; i < 1000; ++i) our_deque.push_back(i);
+  s21::deque<int> copy(our_deque);
+  s21::deque<int> assigned;
+  assigned = copy;
+  s21::deque<int> moved(std::move(our_deque));
+  EXPECT_TRUE(our_deque.empty());
+  EXPECT_EQ(moved.size(), 1000U);
+  for (int i = 0; i < 1000; ++i) {
+    EXPECT_EQ(copy[i], i);
+    EXPECT_EQ(assigned[i], i);
+    EXPECT_EQ(moved[i], i);
+  }
+  copy = std::move(moved);
+  EXPECT_EQ(copy.back(), 999);
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(DequeTest, Iterator) {
+  s21::deque<int> our_deque = {1, 2, 3, 4, 5};
+  int sum = 0;
+  for (auto it = our_deque.begin(); it != our_deque.end(); ++it) sum += *it;
+  EXPECT_EQ(sum, 15);
+  auto it = our_deque.begin() + 2;
+  *it = 10;
+  EXPECT_EQ(our_deque[2], 10);
+  EXPECT_EQ(our_deque.end() - our_deque.begin(), 5);
+  const s21::deque<int> &cref = our_deque;
+  EXPECT_EQ(*(cref.end() - 1), 5);
+}
+
+TEST(DequeTest, Swap) {
+  s21::deque<int> first = {1, 2, 3};
+  s21::deque<int> second = {4};
+  first.swap(second);
+  EXPECT_EQ(first.size(), 1U);
+  EXPECT_EQ(first.front(), 4);
+  EXPECT_EQ(second.size(), 3U);
+  EXPECT_EQ(second.back(), 3);
+}
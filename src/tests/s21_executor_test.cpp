@@ -0,0 +1,117 @@
+#include "../s21_executor/s21_executor.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../s21_work_stealing_deque/s21_work_stealing_deque.h"
+
+TEST(WorkStealingDequeTest, OwnerLifoThiefFifo) {
+  s21::work_stealing_deque<int> d(2);
+  int out = 0;
+  EXPECT_TRUE(d.empty());
+  EXPECT_FALSE(d.try_pop(out));
+  EXPECT_FALSE(d.try_steal(out));
+  for (int i = 0; i < 100; ++i) d.push(i);  // Grows the ring several times.
+  ASSERT_TRUE(d.try_steal(out));
+  EXPECT_EQ(out, 0);
+  ASSERT_TRUE(d.try_pop(out));
+  EXPECT_EQ(out, 99);
+  ASSERT_TRUE(d.try_steal(out));
+  EXPECT_EQ(out, 1);
+  for (int i = 98; i >= 2; --i) {
+    ASSERT_TRUE(d.try_pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_FALSE(d.try_pop(out));
+  EXPECT_TRUE(d.empty());
+}
+
+TEST(WorkStealingDequeTest, EveryItemTakenOnce) {
+  constexpr int kItems = 100000;
+  constexpr int kThieves = 3;
+  s21::work_stealing_deque<int> d;
+  std::vector<std::atomic<int>> taken(kItems);
+  std::atomic<bool> done{false};
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int out = 0;
+      while (!done.load() || !d.empty()) {
+        if (d.try_steal(out))
+          taken[out].fetch_add(1);
+        else
+          std::this_thread::yield();
+      }
+    });
+  }
+  int out = 0;
+  for (int i = 0; i < kItems; ++i) {
+    d.push(i);
+    if (i % 2 && d.try_pop(out)) taken[out].fetch_add(1);
+  }
+  while (d.try_pop(out)) taken[out].fetch_add(1);
+  done.store(true);
+  for (auto &thief : thieves) thief.join();
+  for (int i = 0; i < kItems; ++i) ASSERT_EQ(taken[i].load(), 1) << i;
+}
+
+namespace {
+long Fib(s21::executor &ex, int n) {
+  if (n < 12) return n < 2 ? n : Fib(ex, n - 1) + Fib(ex, n - 2);
+  long a = 0;
+  s21::task_group group(ex);
+  group.spawn([&] { a = Fib(ex, n - 1); });
+  long b = Fib(ex, n - 2);
+  group.wait();
+  return a + b;
+}
+}  // namespace
+
+TEST(ExecutorTest, SpawnAndWait) {
+  s21::executor ex(3);
+  EXPECT_EQ(ex.size(), 3U);
+  std::atomic<int> sum{0};
+  s21::task_group group(ex);
+  for (int i = 1; i <= 1000; ++i) group.spawn([&sum, i] { sum += i; });
+  group.wait();
+  EXPECT_EQ(sum.load(), 500500);
+  group.wait();  // Nothing pending: returns at once.
+}
+
+TEST(ExecutorTest, NestedGroupsDoNotDeadlock) {
+  s21::executor ex(2);
+  EXPECT_EQ(Fib(ex, 25), 75025);
+  s21::executor lonely(1);
+  EXPECT_EQ(Fib(lonely, 22), 17711);
+}
+
+TEST(ExecutorTest, ExceptionReachesWaiter) {
+  s21::executor ex(2);
+  std::atomic<int> ran{0};
+  s21::task_group group(ex);
+  for (int i = 0; i < 50; ++i) {
+    group.spawn([&ran, i] {
+      ++ran;
+      if (i == 17) throw std::runtime_error("task failed");
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(ran.load(), 50);
+  group.spawn([&ran] { ++ran; });
+  EXPECT_NO_THROW(group.wait());
+}
+
+TEST(ExecutorTest, ParallelForVisitsEachIndexOnce) {
+  s21::executor ex(4);
+  std::vector<std::atomic<int>> hits(10007);
+  s21::parallel_for(ex, 0, hits.size(), [&](size_t i) { hits[i] += 1; }, 64);
+  for (size_t i = 0; i < hits.size(); ++i) ASSERT_EQ(hits[i].load(), 1);
+  s21::parallel_for(ex, 5, 5, [](size_t) { FAIL(); });
+  std::atomic<long> sum{0};
+  s21::parallel_for(ex, 0, 100, [&](size_t i) { sum += i; });
+  EXPECT_EQ(sum.load(), 4950);
+}
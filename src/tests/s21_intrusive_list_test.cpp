@@ -0,0 +1,182 @@
+#include "../s21_intrusive_list/s21_intrusive_list.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace {
+struct Session {
+  explicit Session(int id_) : id(id_) {}
+  int id;
+  s21::list_hook<> lru_hook;
+  s21::list_hook<> wait_hook;
+  s21::auto_unlink_hook timer_hook;
+};
+
+using LruList =
+    s21::intrusive_list<Session, s21::list_hook<>, &Session::lru_hook>;
+using WaitList =
+    s21::intrusive_list<Session, s21::list_hook<>, &Session::wait_hook>;
+using TimerList = s21::intrusive_list<Session, s21::auto_unlink_hook,
+                                      &Session::timer_hook>;
+
+std::vector<int> Ids(const LruList &lst) {
+  std::vector<int> res;
+  for (auto it = lst.begin(); it != lst.end(); ++it) res.push_back(it->id);
+  return res;
+}
+}  // namespace
+
+TEST(IntrusiveListTest, Empty) {
+  LruList lst;
+  EXPECT_TRUE(lst.empty());
+  EXPECT_EQ(lst.size(), 0U);
+  EXPECT_THROW(lst.front(), std::out_of_range);
+  EXPECT_THROW(lst.back(), std::out_of_range);
+}
+
+TEST(IntrusiveListTest, PushAndPop) {
+  Session a(1), b(2), c(3);
+  LruList lst;
+  lst.push_back(b);
+  lst.push_front(a);
+  lst.push_back(c);
+  EXPECT_EQ(lst.size(), 3U);
+  EXPECT_EQ(lst.front().id, 1);
+  EXPECT_EQ(lst.back().id, 3);
+  EXPECT_EQ(Ids(lst), (std::vector<int>{1, 2, 3}));
+
+  lst.pop_front();
+  lst.pop_back();
+  EXPECT_EQ(lst.size(), 1U);
+  EXPECT_FALSE(a.lru_hook.is_linked());
+  EXPECT_TRUE(b.lru_hook.is_linked());
+  EXPECT_FALSE(c.lru_hook.is_linked());
+  lst.clear();
+}
+
+TEST(IntrusiveListTest, EraseFromMiddle) {
+  Session a(1), b(2), c(3);
+  LruList lst;
+  lst.push_back(a);
+  lst.push_back(b);
+  lst.push_back(c);
+  lst.erase(b);
+  EXPECT_EQ(Ids(lst), (std::vector<int>{1, 3}));
+  EXPECT_FALSE(b.lru_hook.is_linked());
+  EXPECT_EQ(lst.size(), 2U);
+  lst.clear();
+}
+
+TEST(IntrusiveListTest, MoveToFrontKeepsObject) {
+  Session a(1), b(2), c(3);
+  LruList lst;
+  lst.push_back(a);
+  lst.push_back(b);
+  lst.push_back(c);
+  Session *addr = &c;
+  lst.erase(c);
+  lst.push_front(c);
+  EXPECT_EQ(&lst.front(), addr);
+  EXPECT_EQ(Ids(lst), (std::vector<int>{3, 1, 2}));
+  lst.clear();
+}
+
+TEST(IntrusiveListTest, SeveralListsAtOnce) {
+  Session a(1), b(2);
+  LruList lru;
+  WaitList wait;
+  lru.push_back(a);
+  lru.push_back(b);
+  wait.push_back(b);
+  EXPECT_EQ(lru.size(), 2U);
+  EXPECT_EQ(wait.size(), 1U);
+  EXPECT_EQ(&wait.front(), &lru.back());
+  lru.erase(b);
+  EXPECT_TRUE(b.wait_hook.is_linked());
+  EXPECT_EQ(wait.front().id, 2);
+  lru.clear();
+  wait.clear();
+}
+
+TEST(IntrusiveListTest, DoubleLinkThrows) {
+  Session a(1);
+  LruList first, second;
+  first.push_back(a);
+  EXPECT_THROW(second.push_back(a), std::logic_error);
+  first.clear();
+}
+
+TEST(IntrusiveListTest, AutoUnlink) {
+  TimerList timers;
+  Session a(1);
+  {
+    Session b(2);
+    timers.push_back(a);
+    timers.push_back(b);
+    EXPECT_EQ(timers.size(), 2U);
+  }
+  EXPECT_EQ(timers.size(), 1U);
+  EXPECT_EQ(timers.front().id, 1);
+  a.timer_hook.unlink();
+  EXPECT_TRUE(timers.empty());
+}
+
+TEST(IntrusiveListTest, SpliceAndSwap) {
+  Session a(1), b(2), c(3);
+  LruList first, second;
+  first.push_back(a);
+  second.push_back(b);
+  second.push_back(c);
+  first.splice(first.begin(), second);
+  EXPECT_EQ(Ids(first), (std::vector<int>{2, 3, 1}));
+  EXPECT_TRUE(second.empty());
+
+  first.swap(second);
+  EXPECT_TRUE(first.empty());
+  EXPECT_EQ(second.size(), 3U);
+  EXPECT_EQ(Ids(second), (std::vector<int>{2, 3, 1}));
+
+  LruList third(std::move(second));
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(Ids(third), (std::vector<int>{2, 3, 1}));
+  third.clear();
+  EXPECT_FALSE(a.lru_hook.is_linked());
+}
+
+TEST(IntrusiveListTest, IteratorToAndInsert) {
+  Session a(1), b(2), c(3);
+  LruList lst;
+  lst.push_back(a);
+  lst.push_back(c);
+  auto it = lst.insert(lst.iterator_to(c), b);
+  EXPECT_EQ(it->id, 2);
+  EXPECT_EQ(Ids(lst), (std::vector<int>{1, 2, 3}));
+  it = lst.erase(it);
+  EXPECT_EQ(it->id, 3);
+  --it;
+  EXPECT_EQ((*it).id, 1);
+  lst.clear();
+}
+
+TEST(IntrusiveListTest, NonStandardLayoutObjects) {
+  struct Base {
+    virtual ~Base() = default;
+    virtual int Id() const = 0;
+  };
+  struct Job : Base {
+    explicit Job(int id_) : id(id_) {}
+    int Id() const override { return id; }
+    int id;
+    s21::list_hook<> hook;
+  };
+  Job a(1), b(2);
+  s21::intrusive_list<Job, s21::list_hook<>, &Job::hook> lst;
+  lst.push_back(a);
+  lst.push_back(b);
+  EXPECT_EQ(&lst.front(), &a);
+  EXPECT_EQ(lst.back().Id(), 2);
+  lst.erase(a);
+  EXPECT_EQ(lst.begin()->Id(), 2);
+  lst.clear();
+}
@@ -3,9 +3,30 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 
 using namespace s21;
 
+namespace {
+// Copies throw once the budget runs out; a negative budget never does.
+struct Limited {
+  static int copies_left;
+  Limited() = default;
+  // The list stores its size in the sentinel's element.
+  Limited(size_t v) : value(static_cast<int>(v)) {}
+  explicit Limited(int v) : value(v) {}
+  Limited(const Limited &other) : value(other.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+  }
+  Limited &operator=(const Limited &) = default;
+  int value = 0;
+};
+int Limited::copies_left = -1;
+}  // namespace
+
 TEST(ListTest, ListConstructor) {
   list<int> s21_list{1, 4, 8, 9};
 
@@ -202,3 +223,134 @@ TEST(ListTest, EmplaceFront) {
   our.emplace_front(4, 5, 6);
   EXPECT_EQ(our.front(), 6);
 }
+
+TEST(ListTest, CopyLargeList) {
+  list<int> src;
+  for (int i = 0; i < 1000; ++i) src.push_back(i);
+  list<int> copy(src);
+  list<int> assigned{7, 8};
+  assigned = src;
+
+  EXPECT_EQ(copy.size(), 1000U);
+  EXPECT_EQ(assigned.size(), 1000U);
+  int expected = 0;
+  auto it_assigned = assigned.begin();
+  for (auto it = copy.begin(); it != copy.end(); ++it, ++it_assigned) {
+    EXPECT_EQ(*it, expected);
+    EXPECT_EQ(*it_assigned, expected);
+    ++expected;
+  }
+  EXPECT_EQ(copy.back(), 999);
+}
+
+TEST(ListTest, MoveAssignmentStealsNodes) {
+  list<int> src{1, 2, 3};
+  list<int> dst{4, 5};
+  const int *first = &src.front();
+
+  dst = std::move(src);
+
+  EXPECT_EQ(src.size(), 0U);
+  EXPECT_EQ(dst.size(), 3U);
+  EXPECT_EQ(&dst.front(), first);
+  EXPECT_EQ(dst.back(), 3);
+  src.push_back(10);
+  EXPECT_EQ(src.front(), 10);
+}
+
+TEST(ListTest, InsertRange) {
+  list<int> s21_list_int{1, 5};
+  int values[] = {2, 3, 4};
+
+  auto it = s21_list_int.insert(s21_list_int.begin() + 1, values, values + 3);
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(s21_list_int.size(), 5U);
+  int expected = 1;
+  for (auto i = s21_list_int.begin(); i != s21_list_int.end(); ++i)
+    EXPECT_EQ(*i, expected++);
+
+  list<int> empty;
+  empty.insert(empty.end(), values, values + 3);
+  EXPECT_EQ(empty.front(), 2);
+  EXPECT_EQ(empty.back(), 4);
+  empty.insert(empty.begin(), s21_list_int.begin(), s21_list_int.end());
+  EXPECT_EQ(empty.size(), 8U);
+  EXPECT_EQ(empty.front(), 1);
+  EXPECT_EQ(empty.back(), 4);
+}
+
+TEST(ListTest, InsertFromInputIterator) {
+  std::istringstream in("2 3 4");
+  list<int> lst{1, 5};
+  auto it = lst.insert(lst.begin() + 1, std::istream_iterator<int>(in),
+                       std::istream_iterator<int>());
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(lst.size(), 5U);
+  int expected = 1;
+  for (auto i = lst.begin(); i != lst.end(); ++i) EXPECT_EQ(*i, expected++);
+}
+
+TEST(ListTest, ReuseAfterErase) {
+  list<std::string> lst{"a", "b", "c"};
+  lst.pop_front();
+  auto second = lst.begin();
+  ++second;
+  lst.erase(second);
+  lst.push_back("d");
+  lst.push_front("e");
+  EXPECT_EQ(lst.size(), 3U);
+  EXPECT_EQ(lst.front(), "e");
+  EXPECT_EQ(lst.back(), "d");
+  lst.clear();
+  EXPECT_TRUE(lst.empty());
+  lst.push_back("f");
+  EXPECT_EQ(lst.front(), "f");
+}
+
+TEST(ListTest, ThrowingCopyKeepsList) {
+  struct Fragile {
+    Fragile() = default;
+    // The list stores its size in the sentinel's element.
+    Fragile(size_t v) : value(static_cast<int>(v)) {}
+    explicit Fragile(int v) : value(v) {}
+    Fragile(const Fragile &other) : value(other.value) {
+      if (value < 0) throw std::runtime_error("copy");
+    }
+    Fragile &operator=(const Fragile &) = default;
+    int value = 0;
+  };
+  list<Fragile> lst;
+  for (int i = 0; i < 20; ++i) {
+    EXPECT_THROW(lst.push_back(Fragile(-1)), std::runtime_error);
+    lst.push_back(Fragile(i));
+  }
+  EXPECT_EQ(lst.size(), 20U);
+  EXPECT_EQ(lst.front().value, 0);
+  EXPECT_EQ(lst.back().value, 19);
+}
+
+TEST(ListTest, ThrowingRangeCopyLinksNothing) {
+  list<Limited> source;
+  for (int i = 0; i < 10; ++i) source.push_back(Limited(i));
+
+  Limited::copies_left = 5;
+  EXPECT_THROW(list<Limited> copy(source), std::runtime_error);
+  Limited::copies_left = -1;
+
+  list<Limited> target;
+  target.push_back(Limited(-1));
+  Limited::copies_left = 5;
+  EXPECT_THROW(target.insert(target.begin(), source.begin(), source.end()),
+               std::runtime_error);
+  Limited::copies_left = -1;
+  EXPECT_EQ(target.size(), 1U);
+  EXPECT_EQ(target.front().value, -1);
+
+  Limited::copies_left = 5;
+  EXPECT_THROW(target = source, std::runtime_error);
+  Limited::copies_left = -1;
+  EXPECT_TRUE(target.empty());
+  target = source;
+  EXPECT_EQ(target.size(), 10U);
+  EXPECT_EQ(target.back().value, 9);
+}
@@ -0,0 +1,109 @@
+#include "../s21_lockfree_queue/s21_lockfree_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LockfreeQueueTest, Fifo) {
+  s21::lockfree_queue<std::string> q;
+  std::string out;
+  EXPECT_TRUE(q.empty());
+  EXPECT_FALSE(q.try_pop(out));
+  q.push("a");
+  q.push(std::string("b"));
+  q.emplace(2, 'c');
+  EXPECT_FALSE(q.empty());
+  for (const char *expected : {"a", "b", "cc"}) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(LockfreeQueueTest, GrowsPastReserve) {
+  s21::lockfree_queue<int> q(4);
+  for (int i = 0; i < 1000; ++i) q.push(i);
+  int out;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(LockfreeQueueTest, RecyclesNodes) {
+  s21::lockfree_queue<int> q;
+  int out;
+  for (int round = 0; round < 100; ++round) {
+    for (int i = 0; i < 10; ++i) q.push(i);
+    for (int i = 0; i < 10; ++i) q.try_pop(out);
+  }
+  // Ten values plus the dummy.
+  EXPECT_EQ(q.nodes_created(), 11U);
+}
+
+TEST(LockfreeQueueTest, DestroysRemainingElements) {
+  auto shared = std::make_shared<int>(7);
+  {
+    s21::lockfree_queue<std::shared_ptr<int>> q;
+    q.push(shared);
+    q.push(shared);
+    std::shared_ptr<int> out;
+    q.try_pop(out);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+struct ThrowingCopy {
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy &) { throw std::runtime_error("copy"); }
+  ThrowingCopy &operator=(const ThrowingCopy &) = default;
+};
+
+TEST(LockfreeQueueTest, ThrowingConstructorLeavesQueueIntact) {
+  s21::lockfree_queue<ThrowingCopy> q;
+  ThrowingCopy value;
+  EXPECT_THROW(q.push(value), std::runtime_error);
+  EXPECT_TRUE(q.empty());
+  q.emplace();
+  EXPECT_TRUE(q.try_pop(value));
+}
+
+TEST(LockfreeQueueTest, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 20000;
+  s21::lockfree_queue<int> q;
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (int i = 0; i < kPerProducer; ++i) q.push(p * kPerProducer + i);
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&] {
+      int value;
+      while (consumed.load() < kProducers * kPerProducer) {
+        if (q.try_pop(value)) {
+          seen[value].fetch_add(1);
+          consumed.fetch_add(1);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (auto &t : threads) t.join();
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+  EXPECT_TRUE(q.empty());
+}
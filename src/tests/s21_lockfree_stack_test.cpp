@@ -0,0 +1,94 @@
+#include "../s21_lockfree_stack/s21_lockfree_stack.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(LockfreeStackTest, LifoOrder) {
+  s21::lockfree_stack<int> s;
+  int out = 0;
+  EXPECT_TRUE(s.empty());
+  EXPECT_FALSE(s.try_pop(out));
+  for (int i = 0; i < 5; ++i) s.push(i);
+  EXPECT_FALSE(s.empty());
+  for (int i = 4; i >= 0; --i) {
+    ASSERT_TRUE(s.try_pop(out));
+    EXPECT_EQ(out, i);
+  }
+  EXPECT_TRUE(s.empty());
+}
+
+TEST(LockfreeStackTest, PopAllDetachesNewestFirst) {
+  s21::lockfree_stack<std::string> s;
+  s.push("a");
+  s.emplace(2, 'b');
+  s.push("c");
+  std::vector<std::string> taken;
+  size_t n = s.pop_all([&](std::string &v) { taken.push_back(std::move(v)); });
+  EXPECT_EQ(n, 3U);
+  EXPECT_EQ(taken, (std::vector<std::string>{"c", "bb", "a"}));
+  EXPECT_TRUE(s.empty());
+  EXPECT_EQ(s.pop_all([](std::string &) {}), 0U);
+  s.push("d");
+  std::string out;
+  ASSERT_TRUE(s.try_pop(out));
+  EXPECT_EQ(out, "d");
+}
+
+TEST(LockfreeStackTest, NodesAreRecycled) {
+  s21::lockfree_stack<int> s(16);
+  int out = 0;
+  for (int round = 0; round < 1000; ++round) {
+    for (int i = 0; i < 16; ++i) s.push(i);
+    if (round % 2) {
+      while (s.try_pop(out)) {
+      }
+    } else {
+      s.pop_all([](int &) {});
+    }
+  }
+  EXPECT_EQ(s.nodes_created(), 16U);
+}
+
+TEST(LockfreeStackTest, DestroysRemainingElements) {
+  auto counter = std::make_shared<int>(0);
+  {
+    s21::lockfree_stack<std::shared_ptr<int>> s;
+    for (int i = 0; i < 10; ++i) s.push(counter);
+    EXPECT_EQ(counter.use_count(), 11);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(LockfreeStackTest, ConcurrentPushPop) {
+  constexpr int kThreads = 4;
+  constexpr int kPerThread = 20000;
+  s21::lockfree_stack<int> s;
+  std::vector<std::thread> threads;
+  std::vector<std::vector<int>> seen(kThreads);
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      int out = 0;
+      for (int i = 0; i < kPerThread; ++i) {
+        s.push(t * kPerThread + i);
+        if (i % 3 == 0) {
+          s.pop_all([&](int &v) { seen[t].push_back(v); });
+        } else if (s.try_pop(out)) {
+          seen[t].push_back(out);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::vector<int> all;
+  for (const auto &part : seen) all.insert(all.end(), part.begin(), part.end());
+  s.pop_all([&](int &v) { all.push_back(v); });
+  std::sort(all.begin(), all.end());
+  ASSERT_EQ(all.size(), size_t(kThreads * kPerThread));
+  for (int i = 0; i < kThreads * kPerThread; ++i) EXPECT_EQ(all[i], i);
+}
@@ -3,6 +3,8 @@
 #include <gtest/gtest.h>
 
 #include <map>
+#include <stdexcept>
+#include <string>
 
 TEST(MapTest, DefaultConstructor) {
   s21::map<int, int> s21_map_int;
@@ -329,4 +331,99 @@ TEST(MapTest, Emplace) {
   EXPECT_EQ(emplace1[0].first->first, 9);
   EXPECT_EQ(emplace1[0].second, true);
   EXPECT_EQ(s21_map.size(), 3U);
-}
\ No newline at end of file
+}
+TEST(MapTest, InsertOrAssignAndAt) {
+  s21::map<int, std::string> s21_map;
+  for (int i = 0; i < 1000; ++i) s21_map.insert(i, std::to_string(i));
+  auto res = s21_map.insert_or_assign(500, "five hundred");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(res.first->first, 500);
+  EXPECT_EQ(s21_map.at(500), "five hundred");
+  res = s21_map.insert_or_assign(-1, "minus one");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(s21_map.begin()->second, "minus one");
+  EXPECT_EQ(s21_map.at(999), "999");
+  EXPECT_THROW(s21_map.at(1000), std::out_of_range);
+  EXPECT_EQ(s21_map.size(), 1001U);
+}
+
+TEST(MapTest, KeyedAccess) {
+  s21::map<std::string, int> s21_map;
+  for (int i = 0; i < 100; ++i) ++s21_map["k" + std::to_string(i % 10)];
+  EXPECT_EQ(s21_map.size(), 10U);
+  EXPECT_EQ(s21_map["k3"], 10);
+  s21_map.at("k3") = 7;
+  EXPECT_EQ(s21_map.find("k3")->second, 7);
+  EXPECT_EQ(s21_map.lower_bound("k35")->first, "k4");
+  EXPECT_EQ(s21_map.upper_bound("k4")->first, "k5");
+  EXPECT_EQ(s21_map.erase("k4"), 1U);
+  EXPECT_EQ(s21_map.count("k4"), 0U);
+  EXPECT_THROW(s21_map.find("k4"), std::out_of_range);
+  EXPECT_EQ(s21_map.size(), 9U);
+}
+
+TEST(MapTest, Percentiles) {
+  s21::map<int, std::string, s21::order_stats::on> latencies;
+  for (int ms = 100; ms > 0; --ms) latencies.insert(ms, std::to_string(ms));
+  EXPECT_EQ(latencies.size(), 100U);
+  EXPECT_EQ(latencies.nth_element(49)->first, 50);
+  EXPECT_EQ(latencies.nth_element(98)->second, "99");
+  EXPECT_EQ(latencies.rank(90), 89U);
+  EXPECT_EQ(latencies.count_range(10, 20), 10U);
+  latencies.erase(15);
+  EXPECT_EQ(latencies.count_range(10, 20), 9U);
+  EXPECT_EQ(latencies.size(), 99U);
+}
+
+TEST(MapTest, RangeConstructorAndCopy) {
+  std::map<int, std::string> source;
+  for (int i = 0; i < 500; ++i) source[i] = std::to_string(i);
+  s21::map<int, std::string, s21::order_stats::on> s21_map(source.begin(),
+                                                            source.end());
+  EXPECT_EQ(s21_map.size(), 500U);
+  EXPECT_EQ(s21_map.at(250), "250");
+  s21::map<int, std::string, s21::order_stats::on> copy;
+  copy = s21_map;
+  copy[250] = "changed";
+  copy.erase(0);
+  EXPECT_EQ(s21_map.at(250), "250");
+  EXPECT_EQ(copy.at(250), "changed");
+  EXPECT_EQ(copy.nth_element(0)->first, 1);
+  EXPECT_EQ(s21_map.size(), 500U);
+  EXPECT_EQ(copy.size(), 499U);
+}
+
+TEST(MapTest, Resharding) {
+  s21::map<int, std::string, s21::order_stats::on> shard;
+  for (int i = 0; i < 100; ++i) shard.insert(i, std::to_string(i));
+  s21::map<int, std::string, s21::order_stats::on> upper = shard.split(50);
+  EXPECT_EQ(shard.size(), 50U);
+  EXPECT_EQ(upper.at(75), "75");
+  auto moved = upper.extract(upper.begin());
+  EXPECT_EQ(moved.value().first, 50);
+  moved.value().second = "fifty";
+  EXPECT_TRUE(shard.insert(std::move(moved)).second);
+  EXPECT_EQ(shard.at(50), "fifty");
+  shard.merge(upper);
+  EXPECT_TRUE(upper.empty());
+  EXPECT_EQ(shard.size(), 100U);
+  EXPECT_EQ(shard.nth_element(99)->second, "99");
+}
+
+TEST(MapTest, AppendWithHint) {
+  s21::map<int, std::string, s21::order_stats::on> series;
+  s21::map<int, std::string, s21::order_stats::on>::iterator last;
+  for (int t = 0; t < 1000; ++t) {
+    // Every tenth sample goes to a far away key, away from the hint.
+    if (t % 10 == 9)
+      series.insert(last, {t + 1000, "late"});
+    else
+      last = series.emplace_hint(last, t, std::to_string(t));
+  }
+  EXPECT_EQ(series.size(), 1000U);
+  EXPECT_EQ(series.at(998), "998");
+  EXPECT_EQ(series.at(1009), "late");
+  EXPECT_EQ(series.emplace_hint(series.end(), 500, "dup")->second, "500");
+  EXPECT_EQ(series.nth_element(899)->first, 998);
+  EXPECT_EQ(series.rank(1009), 900U);
+}
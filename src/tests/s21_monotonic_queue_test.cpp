@@ -0,0 +1,115 @@
+#include "../s21_monotonic_queue/s21_monotonic_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "../s21_window_aggregator/s21_window_aggregator.h"
+
+TEST(MonotonicQueueTest, MinMaxFollowTheWindow) {
+  s21::monotonic_queue<int> q;
+  EXPECT_TRUE(q.empty());
+  EXPECT_THROW(q.min(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+  for (int v : {5, 1, 4, 1, 9, 2}) q.push(v);
+  EXPECT_EQ(q.size(), 6U);
+  EXPECT_EQ(q.front(), 5);
+  EXPECT_EQ(q.back(), 2);
+  EXPECT_EQ(q.min(), 1);
+  EXPECT_EQ(q.max(), 9);
+  q.pop();  // 5
+  q.pop();  // 1, the other 1 is still in.
+  EXPECT_EQ(q.min(), 1);
+  q.pop();  // 4
+  q.pop();  // 1
+  EXPECT_EQ(q.min(), 2);
+  EXPECT_EQ(q.max(), 9);
+  q.pop();
+  EXPECT_EQ(q.max(), 2);
+  q.clear();
+  EXPECT_TRUE(q.empty());
+  q.emplace(3);
+  EXPECT_EQ(q.min(), 3);
+}
+
+TEST(MonotonicQueueTest, MatchesRescanOnRandomWindow) {
+  std::mt19937 gen(21);
+  s21::monotonic_queue<std::string> q;
+  std::deque<std::string> window;
+  for (int i = 0; i < 5000; ++i) {
+    std::string value(1 + gen() % 3, static_cast<char>('a' + gen() % 6));
+    q.push(value);
+    window.push_back(value);
+    if (window.size() > 50 || gen() % 4 == 0) {
+      q.pop();
+      window.pop_front();
+    }
+    if (window.empty()) continue;
+    ASSERT_EQ(q.min(), *std::min_element(window.begin(), window.end()));
+    ASSERT_EQ(q.max(), *std::max_element(window.begin(), window.end()));
+  }
+}
+
+TEST(MonotonicQueueTest, CustomCompareSwapsRoles) {
+  s21::monotonic_queue<int, std::greater<int>> q;
+  for (int v : {3, 7, 5}) q.push(v);
+  EXPECT_EQ(q.min(), 7);
+  EXPECT_EQ(q.max(), 3);
+}
+
+namespace {
+struct Moments {
+  double count = 0, sum = 0, squares = 0;
+  double Mean() const { return sum / count; }
+  double Variance() const { return squares / count - Mean() * Mean(); }
+};
+Moments Sample(double x) { return {1, x, x * x}; }
+struct AddMoments {
+  Moments operator()(const Moments &a, const Moments &b) const {
+    return {a.count + b.count, a.sum + b.sum, a.squares + b.squares};
+  }
+};
+}  // namespace
+
+TEST(WindowAggregatorTest, NonCommutativeOpKeepsOrder) {
+  s21::window_aggregator<std::string> w;
+  EXPECT_THROW(w.query(), std::out_of_range);
+  EXPECT_THROW(w.pop(), std::out_of_range);
+  w.push("a");
+  w.push("b");
+  w.push("c");
+  EXPECT_EQ(w.query(), "abc");
+  w.pop();
+  EXPECT_EQ(w.query(), "bc");
+  w.push("d");
+  EXPECT_EQ(w.query(), "bcd");
+  w.pop();
+  w.pop();
+  EXPECT_EQ(w.query(), "d");
+  EXPECT_EQ(w.size(), 1U);
+}
+
+TEST(WindowAggregatorTest, RollingMeanAndVariance) {
+  s21::window_aggregator<Moments, AddMoments> w;
+  std::deque<double> window;
+  std::mt19937 gen(8);
+  for (int i = 0; i < 3000; ++i) {
+    double x = gen() % 1000 / 10.0;
+    w.push(Sample(x));
+    window.push_back(x);
+    if (window.size() > 100) {
+      w.pop();
+      window.pop_front();
+    }
+    double mean = 0, squares = 0;
+    for (double v : window) mean += v / window.size();
+    for (double v : window) squares += (v - mean) * (v - mean);
+    Moments m = w.query();
+    ASSERT_NEAR(m.Mean(), mean, 1e-6);
+    ASSERT_NEAR(m.Variance(), squares / window.size(), 1e-4);
+  }
+}
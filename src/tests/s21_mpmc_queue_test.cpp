@@ -0,0 +1,104 @@
+#include "../s21_mpmc_queue/s21_mpmc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(MpmcQueueTest, CapacityRoundsUp) {
+  s21::mpmc_queue<int> tiny(1);
+  s21::mpmc_queue<int> q(100);
+  EXPECT_EQ(tiny.capacity(), 2U);
+  EXPECT_EQ(q.capacity(), 128U);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(MpmcQueueTest, FullAndEmpty) {
+  s21::mpmc_queue<std::string> q(4);
+  std::string out;
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_push(std::string("b")));
+  EXPECT_TRUE(q.try_emplace(2, 'c'));
+  EXPECT_TRUE(q.try_push("d"));
+  EXPECT_FALSE(q.try_push("e"));
+  EXPECT_EQ(q.size_approx(), 4U);
+  for (const char *expected : {"a", "b", "cc", "d"}) {
+    EXPECT_TRUE(q.try_pop(out));
+    EXPECT_EQ(out, expected);
+  }
+  EXPECT_FALSE(q.try_pop(out));
+  EXPECT_TRUE(q.try_push("f"));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "f");
+}
+
+TEST(MpmcQueueTest, Bulk) {
+  s21::mpmc_queue<int> q(8);
+  int src[12];
+  for (int i = 0; i < 12; ++i) src[i] = i;
+  EXPECT_EQ(q.try_push_n(src, 5), 5U);
+  EXPECT_EQ(q.try_push_n(src + 5, 7), 3U);
+  int dst[12] = {};
+  EXPECT_EQ(q.try_pop_n(dst, 6), 6U);
+  EXPECT_EQ(q.try_push_n(src + 8, 4), 4U);
+  EXPECT_EQ(q.try_pop_n(dst + 6, 12), 6U);
+  for (int i = 0; i < 12; ++i) EXPECT_EQ(dst[i], i);
+  EXPECT_EQ(q.try_pop_n(dst, 4), 0U);
+}
+
+TEST(MpmcQueueTest, DestroysRemainingElements) {
+  auto shared = std::make_shared<int>(7);
+  {
+    s21::mpmc_queue<std::shared_ptr<int>> q(4);
+    q.try_push(shared);
+    q.try_push(shared);
+    std::shared_ptr<int> out;
+    q.try_pop(out);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(MpmcQueueTest, ManyProducersManyConsumers) {
+  constexpr int kProducers = 4;
+  constexpr int kConsumers = 4;
+  constexpr int kPerProducer = 20000;
+  s21::mpmc_queue<int> q(64);
+  std::vector<std::atomic<int>> seen(kProducers * kPerProducer);
+  std::atomic<int> consumed{0};
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&q, p] {
+      for (int i = 0; i < kPerProducer;) {
+        int value = p * kPerProducer + i;
+        if (i % 4 == 0) {
+          int batch[2] = {value, value + 1};
+          i += static_cast<int>(q.try_push_n(batch, 2));
+        } else if (q.try_push(value)) {
+          ++i;
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&, c] {
+      int buf[4];
+      while (consumed.load() < kProducers * kPerProducer) {
+        size_t n = q.try_pop_n(buf, c % 2 ? 4 : 1);
+        if (n == 0) std::this_thread::yield();
+        for (size_t i = 0; i < n; ++i) seen[buf[i]].fetch_add(1);
+        consumed.fetch_add(static_cast<int>(n));
+      }
+    });
+  }
+  for (auto &t : threads) t.join();
+  for (auto &count : seen) ASSERT_EQ(count.load(), 1);
+  EXPECT_TRUE(q.empty());
+}
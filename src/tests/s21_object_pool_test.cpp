@@ -0,0 +1,163 @@
+#include "../s21_object_pool/s21_object_pool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+struct Request {
+  Request(int i, std::string p) : id(i), path(std::move(p)) {}
+  int id;
+  std::string path;
+};
+
+void ExpectBalanced(const s21::object_pool<Request> &pool) {
+  auto stats = pool.stats();
+  EXPECT_EQ(stats.in_use + stats.cached + stats.free, stats.capacity);
+}
+}  // namespace
+
+TEST(ObjectPoolTest, CreateAndDestroy) {
+  s21::object_pool<Request> pool(100);
+  EXPECT_EQ(pool.slab_objects(), 100U);
+  EXPECT_EQ(pool.stats().slabs, 0U);
+  Request *r = pool.create(7, "/index");
+  EXPECT_EQ(r->id, 7);
+  EXPECT_EQ(r->path, "/index");
+  auto stats = pool.stats();
+  EXPECT_EQ(stats.slabs, 1U);
+  EXPECT_EQ(stats.capacity, 100U);
+  EXPECT_EQ(stats.in_use, 1U);
+  ExpectBalanced(pool);
+  pool.destroy(r);
+  pool.destroy(nullptr);
+  EXPECT_EQ(pool.stats().in_use, 0U);
+}
+
+TEST(ObjectPoolTest, SlotsAreRecycled) {
+  s21::object_pool<Request> pool(64);
+  std::vector<Request *> live;
+  for (int i = 0; i < 1000; ++i) live.push_back(pool.create(i, "x"));
+  std::set<Request *> distinct(live.begin(), live.end());
+  EXPECT_EQ(distinct.size(), 1000U);
+  size_t slabs = pool.stats().slabs;
+  EXPECT_EQ(slabs, 16U);
+  for (int round = 0; round < 20; ++round) {
+    for (Request *r : live) pool.destroy(r);
+    for (Request *&r : live) r = pool.create(round, "y");
+  }
+  EXPECT_EQ(pool.stats().slabs, slabs);
+  EXPECT_EQ(pool.stats().in_use, 1000U);
+  ExpectBalanced(pool);
+  for (Request *r : live) pool.destroy(r);
+}
+
+TEST(ObjectPoolTest, HandlesReturnObjects) {
+  s21::object_pool<Request> pool;
+  {
+    auto a = pool.make(1, "a");
+    auto b = pool.make(2, "b");
+    EXPECT_EQ(a->path + b->path, "ab");
+    EXPECT_EQ(pool.stats().in_use, 2U);
+    s21::object_pool<Request>::handle moved = std::move(a);
+    EXPECT_EQ(moved->id, 1);
+    b.reset();
+    EXPECT_EQ(pool.stats().in_use, 1U);
+  }
+  EXPECT_EQ(pool.stats().in_use, 0U);
+  ExpectBalanced(pool);
+}
+
+TEST(ObjectPoolTest, ThrowingConstructorReleasesSlot) {
+  struct Fragile {
+    explicit Fragile(bool fail) {
+      if (fail) throw std::runtime_error("no");
+    }
+    char payload[48];
+  };
+  s21::object_pool<Fragile> pool(32);
+  EXPECT_THROW(pool.create(true), std::runtime_error);
+  EXPECT_EQ(pool.stats().in_use, 0U);
+  Fragile *f = pool.create(false);
+  EXPECT_EQ(pool.stats().in_use, 1U);
+  pool.destroy(f);
+}
+
+TEST(ObjectPoolTest, ThreadsShareThePool) {
+  s21::object_pool<Request> pool(256);
+  std::vector<std::thread> threads;
+  std::vector<std::vector<Request *>> kept(4);
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&pool, &kept, t] {
+      std::vector<Request *> live;
+      for (int i = 0; i < 20050; ++i) {
+        live.push_back(pool.create(i, "t"));
+        if (live.size() == 100) {
+          for (Request *r : live) pool.destroy(r);
+          live.clear();
+        }
+      }
+      kept[t] = live;
+    });
+  }
+  for (auto &thread : threads) thread.join();
+  std::set<Request *> distinct;
+  for (auto &live : kept)
+    for (Request *r : live) distinct.insert(r);
+  EXPECT_EQ(distinct.size(), 200U);
+  EXPECT_EQ(pool.stats().in_use, 200U);
+  // Objects created on one thread may be destroyed on another.
+  std::thread other([&] {
+    for (auto &live : kept)
+      for (Request *r : live) pool.destroy(r);
+  });
+  other.join();
+  EXPECT_EQ(pool.stats().in_use, 0U);
+  ExpectBalanced(pool);
+}
+
+TEST(ObjectPoolTest, ManyPoolsOnOneThread) {
+  // More pools than a thread keeps caches for, so caches get evicted.
+  using Pool = s21::object_pool<Request>;
+  std::vector<std::unique_ptr<Pool>> pools;
+  std::vector<Request *> live;
+  for (int round = 0; round < 3; ++round) {
+    for (int p = 0; p < 12; ++p) {
+      if (round == 0) pools.push_back(std::make_unique<Pool>(64));
+      live.push_back(pools[p]->create(p, "r"));
+    }
+  }
+  for (size_t i = 0; i < live.size(); ++i) pools[i % 12]->destroy(live[i]);
+  for (auto &pool : pools) {
+    EXPECT_EQ(pool->stats().in_use, 0U);
+    ExpectBalanced(*pool);
+  }
+  pools.clear();
+  Pool after;  // Reuses entries of destroyed pools.
+  after.destroy(after.create(1, "ok"));
+  EXPECT_EQ(after.stats().in_use, 0U);
+}
+
+TEST(ObjectPoolTest, PoolsSharingACacheSlotKeepTheirCaches) {
+  // Pool ids are handed out in order, so the first and the last of nine
+  // pools map to the same thread cache slot.
+  using Pool = s21::object_pool<Request>;
+  std::vector<std::unique_ptr<Pool>> pools;
+  for (int p = 0; p < 9; ++p) pools.push_back(std::make_unique<Pool>(64));
+  Pool &first = *pools.front();
+  Pool &last = *pools.back();
+  for (int i = 0; i < 100; ++i) {
+    first.destroy(first.create(i, "a"));
+    last.destroy(last.create(i, "b"));
+  }
+  // An evicted cache would have handed its free slots back to the pool.
+  EXPECT_GT(first.stats().cached, 0U);
+  EXPECT_GT(last.stats().cached, 0U);
+  ExpectBalanced(first);
+  ExpectBalanced(last);
+}
@@ -0,0 +1,127 @@
+#include "../s21_pairing_heap/s21_pairing_heap.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+template <typename Heap>
+std::vector<int> Drain(Heap &heap) {
+  std::vector<int> out;
+  while (!heap.empty()) {
+    out.push_back(heap.top());
+    heap.pop();
+  }
+  return out;
+}
+}  // namespace
+
+TEST(PairingHeapTest, PopsInOrder) {
+  s21::pairing_heap<int> heap;
+  std::vector<int> values(1000);
+  std::mt19937 gen(1);
+  for (int &value : values) value = static_cast<int>(gen() % 500);
+  for (int value : values) heap.push(value);
+  EXPECT_EQ(heap.size(), 1000U);
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(Drain(heap), values);
+  EXPECT_THROW(heap.top(), std::out_of_range);
+  EXPECT_THROW(heap.pop(), std::out_of_range);
+}
+
+TEST(PairingHeapTest, DecreaseKey) {
+  s21::pairing_heap<int> heap;
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  for (int i = 0; i < 100; ++i) handles.push_back(heap.push(1000 + i));
+  heap.decrease_key(handles[50], 5);
+  heap.decrease_key(handles[70], 3);
+  heap.decrease_key(handles[0], 1000);
+  EXPECT_EQ(*handles[50], 5);
+  EXPECT_EQ(heap.top(), 3);
+  heap.pop();
+  EXPECT_EQ(heap.top(), 5);
+  heap.decrease_key(handles[99], 4);
+  EXPECT_EQ(heap.top(), 4);
+  EXPECT_THROW(heap.decrease_key(handles[10], 2000), std::invalid_argument);
+}
+
+TEST(PairingHeapTest, Erase) {
+  s21::pairing_heap<int> heap;
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  for (int i = 0; i < 50; ++i) handles.push_back(heap.push(i));
+  heap.pop();
+  heap.push(100);
+  for (int i = 2; i < 50; i += 2) heap.erase(handles[i]);
+  heap.erase(handles[1]);
+  std::vector<int> expected;
+  for (int i = 3; i < 50; i += 2) expected.push_back(i);
+  expected.push_back(100);
+  EXPECT_EQ(Drain(heap), expected);
+}
+
+TEST(PairingHeapTest, MeldKeepsHandles) {
+  s21::pairing_heap<int> a;
+  s21::pairing_heap<int> b;
+  for (int i = 0; i < 40; ++i) a.push(2 * i + 10);
+  std::vector<s21::pairing_heap<int>::handle> handles;
+  for (int i = 0; i < 40; ++i) handles.push_back(b.push(2 * i + 11));
+  a.meld(b);
+  EXPECT_TRUE(b.empty());
+  EXPECT_EQ(a.size(), 80U);
+  a.decrease_key(handles[39], 0);
+  a.erase(handles[0]);
+  EXPECT_EQ(a.top(), 0);
+  // b still works after giving its nodes away.
+  b.push(7);
+  EXPECT_EQ(b.top(), 7);
+  std::vector<int> drained = Drain(a);
+  EXPECT_EQ(drained.size(), 79U);
+  EXPECT_TRUE(std::is_sorted(drained.begin(), drained.end()));
+}
+
+TEST(PairingHeapTest, RandomOperationsMatchReference) {
+  s21::pairing_heap<int, std::greater<int>> heap;
+  std::vector<std::pair<s21::pairing_heap<int, std::greater<int>>::handle,
+                        int>>
+      live;
+  std::mt19937 gen(7);
+  for (int step = 0; step < 20000; ++step) {
+    unsigned op = gen() % 4;
+    if (op == 0 || live.empty()) {
+      int value = static_cast<int>(gen() % 10000);
+      live.push_back({heap.push(value), value});
+    } else if (op == 1) {
+      size_t i = gen() % live.size();
+      live[i].second += static_cast<int>(gen() % 100);
+      heap.decrease_key(live[i].first, live[i].second);
+    } else if (op == 2) {
+      size_t i = gen() % live.size();
+      heap.erase(live[i].first);
+      live[i] = live.back();
+      live.pop_back();
+    } else {
+      auto best = std::max_element(
+          live.begin(), live.end(),
+          [](const auto &x, const auto &y) { return x.second < y.second; });
+      ASSERT_EQ(heap.top(), best->second);
+    }
+    ASSERT_EQ(heap.size(), live.size());
+  }
+}
+
+TEST(PairingHeapTest, MoveAndDestroy) {
+  auto shared = std::make_shared<int>(1);
+  {
+    s21::pairing_heap<std::shared_ptr<int>> heap;
+    for (int i = 0; i < 100; ++i) heap.push(shared);
+    auto moved = std::move(heap);
+    EXPECT_TRUE(heap.empty());
+    EXPECT_EQ(moved.size(), 100U);
+    EXPECT_EQ(shared.use_count(), 101);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
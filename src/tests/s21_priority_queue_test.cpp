@@ -0,0 +1,130 @@
+#include "../s21_priority_queue/s21_priority_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "../s21_deque/s21_deque.h"
+
+namespace {
+template <typename Queue>
+std::vector<int> Drain(Queue &q) {
+  std::vector<int> out;
+  while (!q.empty()) {
+    out.push_back(q.top());
+    q.pop();
+  }
+  return out;
+}
+
+std::vector<int> RandomValues(size_t n, unsigned seed) {
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, 1000);
+  std::vector<int> values(n);
+  for (int &value : values) value = dist(gen);
+  return values;
+}
+}  // namespace
+
+TEST(PriorityQueueTest, PushPopMatchesStd) {
+  s21::priority_queue<int> q;
+  std::priority_queue<int> expected;
+  std::mt19937 gen(1);
+  for (int step = 0; step < 5000; ++step) {
+    if (gen() % 3 != 0 || expected.empty()) {
+      int value = static_cast<int>(gen() % 100);
+      q.push(value);
+      expected.push(value);
+    } else {
+      ASSERT_EQ(q.top(), expected.top());
+      q.pop();
+      expected.pop();
+    }
+    ASSERT_EQ(q.size(), expected.size());
+  }
+}
+
+TEST(PriorityQueueTest, HeapifyFromRange) {
+  std::vector<int> values = RandomValues(1000, 2);
+  s21::priority_queue<int> q(values.begin(), values.end());
+  std::sort(values.rbegin(), values.rend());
+  EXPECT_EQ(Drain(q), values);
+
+  s21::priority_queue<int> small = {3, 9, 1, 7};
+  EXPECT_EQ(Drain(small), std::vector<int>({9, 7, 3, 1}));
+}
+
+TEST(PriorityQueueTest, CustomCompareAndArity) {
+  std::vector<int> values = RandomValues(500, 3);
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>, 2> binary(
+      values.begin(), values.end());
+  s21::priority_queue<int, s21::deque<int>, std::greater<int>, 8> wide(
+      values.begin(), values.end());
+  std::sort(values.begin(), values.end());
+  EXPECT_EQ(Drain(binary), values);
+  EXPECT_EQ(Drain(wide), values);
+}
+
+TEST(PriorityQueueTest, PushRange) {
+  std::vector<int> first = RandomValues(400, 4);
+  std::vector<int> small_batch = RandomValues(10, 5);
+  std::vector<int> large_batch = RandomValues(1000, 6);
+  s21::priority_queue<int> q(first.begin(), first.end());
+  q.push_range(small_batch.begin(), small_batch.end());
+  q.push_range(large_batch.begin(), large_batch.end());
+  std::vector<int> all = first;
+  all.insert(all.end(), small_batch.begin(), small_batch.end());
+  all.insert(all.end(), large_batch.begin(), large_batch.end());
+  std::sort(all.rbegin(), all.rend());
+  EXPECT_EQ(Drain(q), all);
+}
+
+TEST(PriorityQueueTest, ReplaceTopKeepsSmallestK) {
+  std::vector<int> values = RandomValues(2000, 7);
+  // A max-heap of the k smallest values seen so far.
+  s21::priority_queue<int> q(values.begin(), values.begin() + 10);
+  for (size_t i = 10; i < values.size(); ++i) {
+    if (values[i] < q.top()) {
+      EXPECT_GE(q.replace_top(values[i]), values[i]);
+    }
+  }
+  std::sort(values.begin(), values.end());
+  std::vector<int> smallest(values.rend() - 10, values.rend());
+  EXPECT_EQ(Drain(q), smallest);
+}
+
+TEST(PriorityQueueTest, EmptyAndSwap) {
+  s21::priority_queue<std::string> q;
+  EXPECT_THROW(q.top(), std::out_of_range);
+  EXPECT_THROW(q.pop(), std::out_of_range);
+  EXPECT_THROW(q.replace_top("a"), std::out_of_range);
+  s21::priority_queue<std::string> other = {"b", "c", "a"};
+  q.swap(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(q.top(), "c");
+  s21::priority_queue<std::string> copy(q);
+  s21::priority_queue<std::string> moved(std::move(q));
+  EXPECT_EQ(copy.size(), 3U);
+  EXPECT_EQ(moved.top(), "c");
+}
+
+TEST(PriorityQueueTest, CopyAssignment) {
+  s21::priority_queue<int> q = {3, 1, 2};
+  s21::priority_queue<int> copy = {7};
+  copy = q;
+  q.pop();
+  EXPECT_EQ(Drain(copy), (std::vector<int>{3, 2, 1}));
+  EXPECT_EQ(Drain(q), (std::vector<int>{2, 1}));
+  s21::priority_queue<int, s21::deque<int>, std::greater<int>> low = {5, 4};
+  s21::priority_queue<int, s21::deque<int>, std::greater<int>> other;
+  other = low;
+  const auto &self = other;
+  other = self;
+  EXPECT_EQ(Drain(other), (std::vector<int>{4, 5}));
+  EXPECT_EQ(low.size(), 2U);
+}
@@ -154,4 +154,43 @@ TEST(Queue, Swap) {
   EXPECT_EQ(our_queue_empty.front(), std_queue_empty.front());
   EXPECT_EQ(our_queue_empty.back(), std_queue_empty.back());
   EXPECT_EQ(our_queue_int.empty(), std_queue_int.empty());
-}
\ No newline at end of file
+}
+TEST(Queue, ListContainer) {
+  s21::queue<int, s21::list<int>> our_queue = {1, 2, 3};
+  our_queue.push(4);
+  our_queue.pop();
+  EXPECT_EQ(our_queue.front(), 2);
+  EXPECT_EQ(our_queue.back(), 4);
+  EXPECT_EQ(our_queue.size(), 3U);
+}
+
+TEST(Queue, RollingWindow) {
+  s21::queue<int> our_queue;
+  std::queue<int> std_queue;
+  for (int i = 0; i < 10000; ++i) {
+    our_queue.push(i);
+    std_queue.push(i);
+    if (i % 3 != 0) {
+      our_queue.pop();
+      std_queue.pop();
+    }
+    EXPECT_EQ(our_queue.front(), std_queue.front());
+    EXPECT_EQ(our_queue.back(), std_queue.back());
+  }
+  EXPECT_EQ(our_queue.size(), std_queue.size());
+}
+
+TEST(Queue, EmptyQueueIsForgiving) {
+  s21::queue<int> our_queue;
+  s21::queue<int, s21::list<int>> list_queue;
+  our_queue.pop();
+  list_queue.pop();
+  EXPECT_EQ(our_queue.front(), 0);
+  EXPECT_EQ(our_queue.back(), 0);
+  EXPECT_EQ(list_queue.front(), our_queue.front());
+  our_queue.push(7);
+  our_queue.pop();
+  our_queue.pop();
+  EXPECT_TRUE(our_queue.empty());
+  EXPECT_EQ(our_queue.front(), 0);
+}
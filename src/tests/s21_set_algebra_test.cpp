@@ -0,0 +1,143 @@
+#include "../s21_set_algebra/s21_set_algebra.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+using RankedSet = s21::set<int, s21::order_stats::on>;
+
+template <typename Set>
+std::vector<int> Keys(const Set &set) {
+  std::vector<int> keys;
+  if (!set.empty())
+    for (auto it = set.begin(); it != typename Set::iterator(); ++it)
+      keys.push_back(*it);
+  EXPECT_EQ(keys.size(), set.size());
+  return keys;
+}
+
+s21::set<int> RandomSet(std::mt19937 &gen, size_t n, int range,
+                        std::set<int> &mirror) {
+  s21::set<int> set;
+  for (size_t i = 0; i < n; ++i) {
+    int key = static_cast<int>(gen() % range);
+    set.insert(key);
+    mirror.insert(key);
+  }
+  return set;
+}
+
+// Runs the four operations with and without the executor and checks
+// them against the std algorithms.
+template <typename Set>
+void ExpectMatchesStd(s21::executor &ex, const Set &a, const std::set<int> &sa,
+                      const Set &b, const std::set<int> &sb) {
+  std::vector<int> expected;
+  std::set_union(sa.begin(), sa.end(), sb.begin(), sb.end(),
+                 std::back_inserter(expected));
+  EXPECT_EQ(Keys(s21::set_union(a, b)), expected);
+  EXPECT_EQ(Keys(s21::set_union(ex, a, b)), expected);
+  expected.clear();
+  std::set_intersection(sa.begin(), sa.end(), sb.begin(), sb.end(),
+                        std::back_inserter(expected));
+  EXPECT_EQ(Keys(s21::set_intersection(a, b)), expected);
+  EXPECT_EQ(Keys(s21::set_intersection(ex, a, b)), expected);
+  expected.clear();
+  std::set_difference(sa.begin(), sa.end(), sb.begin(), sb.end(),
+                      std::back_inserter(expected));
+  EXPECT_EQ(Keys(s21::set_difference(a, b)), expected);
+  EXPECT_EQ(Keys(s21::set_difference(ex, a, b)), expected);
+  expected.clear();
+  std::set_symmetric_difference(sa.begin(), sa.end(), sb.begin(), sb.end(),
+                                std::back_inserter(expected));
+  EXPECT_EQ(Keys(s21::symmetric_difference(a, b)), expected);
+  EXPECT_EQ(Keys(s21::symmetric_difference(ex, a, b)), expected);
+}
+}  // namespace
+
+TEST(SetAlgebraTest, SmallExamples) {
+  s21::set<int> a = {1, 2, 3, 4};
+  s21::set<int> b = {3, 4, 5};
+  s21::set<int> empty;
+  EXPECT_EQ(Keys(s21::set_union(a, b)), (std::vector<int>{1, 2, 3, 4, 5}));
+  EXPECT_EQ(Keys(s21::set_intersection(a, b)), (std::vector<int>{3, 4}));
+  EXPECT_EQ(Keys(s21::set_difference(a, b)), (std::vector<int>{1, 2}));
+  EXPECT_EQ(Keys(s21::set_difference(b, a)), (std::vector<int>{5}));
+  EXPECT_EQ(Keys(s21::symmetric_difference(a, b)),
+            (std::vector<int>{1, 2, 5}));
+  EXPECT_EQ(s21::set_union(a, empty).size(), 4U);
+  EXPECT_TRUE(s21::set_intersection(empty, a).empty());
+  EXPECT_EQ(a.size(), 4U);
+  EXPECT_EQ(b.size(), 3U);
+}
+
+TEST(SetAlgebraTest, RandomSetsOfSimilarSize) {
+  s21::executor ex(4);
+  std::mt19937 gen(49);
+  for (int round = 0; round < 4; ++round) {
+    std::set<int> sa, sb;
+    s21::set<int> a = RandomSet(gen, 20000, 60000, sa);
+    s21::set<int> b = RandomSet(gen, 20000, 60000, sb);
+    ExpectMatchesStd(ex, a, sa, b, sb);
+    RankedSet ranked_a(sa.begin(), sa.end());
+    RankedSet ranked_b(sb.begin(), sb.end());
+    ExpectMatchesStd(ex, ranked_a, sa, ranked_b, sb);
+  }
+}
+
+TEST(SetAlgebraTest, VeryDifferentSizes) {
+  s21::executor ex(4);
+  std::mt19937 gen(50);
+  std::set<int> sa, sb, sc;
+  s21::set<int> big = RandomSet(gen, 50000, 100000, sa);
+  s21::set<int> small = RandomSet(gen, 20, 100000, sb);
+  s21::set<int> none;
+  ExpectMatchesStd(ex, big, sa, small, sb);
+  ExpectMatchesStd(ex, small, sb, big, sa);
+  ExpectMatchesStd(ex, none, sc, big, sa);
+  RankedSet ranked_big(sa.begin(), sa.end());
+  RankedSet ranked_small(sb.begin(), sb.end());
+  ExpectMatchesStd(ex, ranked_big, sa, ranked_small, sb);
+  ExpectMatchesStd(ex, ranked_small, sb, ranked_big, sa);
+}
+
+TEST(SetAlgebraTest, ResultsAreIndependentTrees) {
+  s21::executor ex(2);
+  RankedSet a, b;
+  for (int i = 0; i < 10000; ++i) a.insert(i);
+  for (int i = 5000; i < 15000; ++i) b.insert(i);
+  RankedSet u = s21::set_union(ex, a, b);
+  EXPECT_EQ(u.size(), 15000U);
+  EXPECT_EQ(u.rank(7500), 7500U);
+  u.erase(7500);
+  u.insert(-1);
+  EXPECT_TRUE(a.contains(7500));
+  EXPECT_TRUE(b.contains(7500));
+  EXPECT_EQ(*u.begin(), -1);
+  RankedSet i = s21::set_intersection(ex, a, b);
+  i.merge(u);
+  EXPECT_EQ(i.size(), 15001U);  // 7500 comes back from the intersection.
+}
+
+TEST(SetAlgebraTest, MapsKeepFirstOperandValues) {
+  s21::map<int, std::string> first, second;
+  for (int i = 0; i < 3000; ++i) first.insert(i, "first");
+  for (int i = 2000; i < 5000; ++i) second.insert(i, "second");
+  s21::executor ex(2);
+  auto both = s21::set_intersection(ex, first, second);
+  EXPECT_EQ(both.size(), 1000U);
+  EXPECT_EQ(both.at(2500), "first");
+  auto all = s21::set_union(second, first);
+  EXPECT_EQ(all.size(), 5000U);
+  EXPECT_EQ(all.at(2500), "second");
+  EXPECT_EQ(all.at(100), "first");
+  auto only = s21::symmetric_difference(first, second);
+  EXPECT_EQ(only.size(), 4000U);
+  EXPECT_FALSE(only.contains(2500));
+}
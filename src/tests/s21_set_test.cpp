@@ -2,7 +2,85 @@
 
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <random>
 #include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// Exposes the tree so tests can check that it stays an AVL tree.
+template <typename Set>
+class CheckedSet : public Set {
+ public:
+  bool Balanced() const {
+    return !this->root_ || (!this->root_->parent_ && Height(this->root_) > 0);
+  }
+
+ private:
+  using Node = typename Set::Node_;
+
+  // The subtree's height, or -1 if a link, a height or a balance is off.
+  static int Height(const Node *node) {
+    if (!node) return 0;
+    if ((node->left_ && node->left_->parent_ != node) ||
+        (node->right_ && node->right_->parent_ != node))
+      return -1;
+    int left = Height(node->left_);
+    int right = Height(node->right_);
+    if (left < 0 || right < 0 || left - right > 1 || right - left > 1)
+      return -1;
+    int height = 1 + (left > right ? left : right);
+    return static_cast<int>(node->height_) == height ? height : -1;
+  }
+};
+
+template <typename Set>
+void CheckHintedInsertKeepsBalance() {
+  CheckedSet<Set> s21_set;
+  std::set<int> std_set;
+  std::mt19937 gen(50);
+  for (int i = 0; i < 5000; ++i) {
+    int key = static_cast<int>(gen() % 2000);
+    switch (gen() % 6) {
+      case 0:
+        if (std_set.erase(key) != 0) s21_set.erase(key);
+        break;
+      case 1:
+        if (!std_set.empty()) {
+          auto it = std_set.lower_bound(key);
+          if (it == std_set.end()) --it;
+          s21_set.erase(s21_set.find(*it));
+          std_set.erase(it);
+        }
+        break;
+      case 2:
+        // Appending after the largest element, as a time series does.
+        key = std_set.empty() ? key : *std_set.rbegin() + 1;
+        s21_set.insert(s21_set.empty() ? typename Set::iterator()
+                                       : s21_set.end(),
+                       key);
+        std_set.insert(key);
+        break;
+      default: {
+        // Hints next to and far from the key, and the null hint.
+        typename Set::iterator hint;
+        if (!s21_set.empty() && gen() % 4 != 0)
+          hint = s21_set.lower_bound(static_cast<int>(gen() % 2000));
+        s21_set.emplace_hint(hint, key);
+        std_set.insert(key);
+      }
+    }
+    ASSERT_TRUE(s21_set.Balanced());
+    ASSERT_EQ(s21_set.size(), std_set.size());
+    if (!std_set.empty()) {
+      ASSERT_EQ(*s21_set.begin(), *std_set.begin());
+      ASSERT_EQ(*s21_set.end(), *std_set.rbegin());
+    }
+  }
+}
+}  // namespace
 
 TEST(SetTest, DefaultConstructor) {
   s21::set<int> s21_set_int;
@@ -171,7 +249,220 @@ TEST(SetTest, Emplace) {
   std::vector<std::pair<s21::set<int>::iterator, bool>> emplace1 =
       s21_set.emplace(9, 9, 9, 23, 98);
 
-  EXPECT_EQ(*emplace1[0].first, 23);
+  EXPECT_EQ(*emplace1[0].first, 9);
   EXPECT_EQ(emplace1[0].second, true);
   EXPECT_EQ(s21_set.size(), 3U);
-}
\ No newline at end of file
+}
+TEST(SetTest, RandomInsertEraseMatchesStdSet) {
+  s21::set<int> s21_set;
+  std::set<int> std_set;
+  std::mt19937 gen(44);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 2000);
+    if (gen() % 3 != 0) {
+      EXPECT_EQ(s21_set.insert(key).second, std_set.insert(key).second);
+    } else if (std_set.erase(key) != 0) {
+      auto it = s21_set.begin();
+      while (*it != key) ++it;
+      s21_set.erase(it);
+    }
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  auto it = s21_set.begin();
+  for (int key : std_set) EXPECT_EQ(*it++, key);
+  EXPECT_EQ(it, s21::set<int>::iterator());
+  --it;
+  EXPECT_EQ(*it, *std_set.rbegin());
+}
+
+TEST(SetTest, IteratorsSurviveRebalancing) {
+  s21::set<std::string> s21_set;
+  auto kept = s21_set.insert("m").first;
+  const std::string *address = &*kept;
+  for (char c = 'a'; c <= 'z'; ++c) s21_set.insert(std::string(1, c));
+  for (int i = 0; i < 1000; ++i) s21_set.insert(std::to_string(i));
+  auto it = s21_set.begin();
+  while (*it != "a") ++it;
+  s21_set.erase(it);
+  EXPECT_EQ(&*kept, address);
+  EXPECT_EQ(*kept, "m");
+  EXPECT_EQ(*++kept, "n");
+  EXPECT_EQ(s21_set.size(), 1025U);
+}
+
+TEST(SetTest, BoundsAndEraseByKey) {
+  s21::set<int> s21_set;
+  for (int i = 0; i < 100; i += 10) s21_set.insert(i);
+  EXPECT_EQ(*s21_set.lower_bound(30), 30);
+  EXPECT_EQ(*s21_set.lower_bound(31), 40);
+  EXPECT_EQ(*s21_set.upper_bound(30), 40);
+  EXPECT_EQ(*s21_set.lower_bound(-5), 0);
+  EXPECT_EQ(s21_set.lower_bound(91), s21::set<int>::iterator());
+  EXPECT_EQ(s21_set.upper_bound(90), s21::set<int>::iterator());
+  auto range = s21_set.equal_range(50);
+  EXPECT_EQ(*range.first, 50);
+  EXPECT_EQ(*range.second, 60);
+  range = s21_set.equal_range(55);
+  EXPECT_EQ(range.first, range.second);
+  EXPECT_EQ(s21_set.count(70), 1U);
+  EXPECT_EQ(s21_set.count(75), 0U);
+  EXPECT_EQ(s21_set.erase(70), 1U);
+  EXPECT_EQ(s21_set.erase(70), 0U);
+  EXPECT_FALSE(s21_set.contains(70));
+  EXPECT_EQ(*s21_set.find(80), 80);
+  EXPECT_THROW(s21_set.find(70), std::out_of_range);
+  EXPECT_EQ(s21_set.size(), 9U);
+}
+
+TEST(SetTest, OrderStatistics) {
+  s21::set<int, s21::order_stats::on> s21_set;
+  std::set<int> std_set;
+  std::mt19937 gen(46);
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(gen() % 1000);
+    if (gen() % 4 == 0) {
+      EXPECT_EQ(s21_set.erase(key), std_set.erase(key));
+    } else {
+      s21_set.insert(key);
+      std_set.insert(key);
+    }
+    ASSERT_EQ(s21_set.size(), std_set.size());
+  }
+  size_t k = 0;
+  for (int key : std_set) {
+    EXPECT_EQ(*s21_set.nth_element(k), key);
+    EXPECT_EQ(s21_set.rank(key), k);
+    ++k;
+  }
+  EXPECT_THROW(s21_set.nth_element(k), std::out_of_range);
+  EXPECT_EQ(s21_set.rank(-1), 0U);
+  EXPECT_EQ(s21_set.rank(1000), std_set.size());
+  auto low = std_set.lower_bound(250);
+  auto high = std_set.lower_bound(750);
+  EXPECT_EQ(s21_set.count_range(250, 750),
+            static_cast<size_t>(std::distance(low, high)));
+  EXPECT_EQ(s21_set.count_range(750, 250), 0U);
+}
+
+TEST(SetTest, RangeConstructorAndAssign) {
+  std::vector<int> sorted(1000);
+  for (int i = 0; i < 1000; ++i) sorted[i] = 2 * i;
+  s21::set<int, s21::order_stats::on> built(sorted.begin(), sorted.end());
+  EXPECT_EQ(built.size(), 1000U);
+  EXPECT_EQ(*built.nth_element(500), 1000);
+  EXPECT_EQ(built.rank(1001), 501U);
+  built.insert(1);
+  built.erase(0);
+  EXPECT_EQ(*built.begin(), 1);
+
+  std::vector<int> unsorted = {5, 3, 5, 1, 4, 1};
+  s21::set<int> inserted(unsorted.begin(), unsorted.end());
+  EXPECT_EQ(inserted.size(), 4U);
+  EXPECT_EQ(*inserted.begin(), 1);
+
+  s21::set<int, s21::order_stats::on> copy(built);
+  copy.erase(1);
+  EXPECT_EQ(copy.size(), 999U);
+  EXPECT_EQ(*copy.begin(), 2);
+  EXPECT_EQ(*built.begin(), 1);
+  EXPECT_EQ(*copy.nth_element(998), 1998);
+
+  std::set<std::string> source = {"a", "b", "c"};
+  s21::set<std::string> strings;
+  strings.assign(source.begin(), source.end());
+  EXPECT_EQ(strings.size(), 3U);
+  strings.assign({"z", "y"});
+  EXPECT_EQ(*strings.begin(), "y");
+  EXPECT_EQ(strings.size(), 2U);
+}
+
+TEST(SetTest, SplitAndJoin) {
+  s21::set<int, s21::order_stats::on> low;
+  for (int i = 0; i < 1000; ++i) low.insert(i);
+  const int *kept = &*low.find(700);
+  s21::set<int, s21::order_stats::on> high = low.split(600);
+  EXPECT_EQ(low.size(), 600U);
+  EXPECT_EQ(high.size(), 400U);
+  EXPECT_EQ(*low.end(), 599);
+  EXPECT_EQ(*high.begin(), 600);
+  EXPECT_EQ(&*high.find(700), kept);
+  EXPECT_EQ(high.rank(700), 100U);
+  EXPECT_THROW(high.join(low), std::logic_error);
+  low.join(high);
+  EXPECT_TRUE(high.empty());
+  EXPECT_EQ(low.size(), 1000U);
+  EXPECT_EQ(*low.nth_element(700), 700);
+  EXPECT_EQ(low.split(-1).size(), 1000U);
+  EXPECT_TRUE(low.empty());
+}
+
+TEST(SetTest, SplitWithoutOrderStatistics) {
+  // Sizes then come from walking the smaller half.
+  s21::set<int> low;
+  for (int i = 0; i < 1000; ++i) low.insert(i);
+  std::mt19937 gen(46);
+  for (int round = 0; round < 50; ++round) {
+    int key = static_cast<int>(gen() % 1100) - 50;
+    s21::set<int> high = low.split(key);
+    size_t expected = key < 0 ? 0 : key > 1000 ? 1000 : key;
+    EXPECT_EQ(low.size(), expected);
+    EXPECT_EQ(high.size(), 1000U - expected);
+    low.join(high);
+    EXPECT_EQ(low.size(), 1000U);
+  }
+}
+
+TEST(SetTest, MergeRelinksNodes) {
+  s21::set<std::string> ours = {"a", "c", "e"};
+  s21::set<std::string> theirs = {"b", "c", "d"};
+  const std::string *b = &*theirs.find("b");
+  const std::string *c = &*theirs.find("c");
+  ours.merge(theirs);
+  EXPECT_EQ(ours.size(), 5U);
+  EXPECT_EQ(&*ours.find("b"), b);
+  // Already present keys stay where they were.
+  EXPECT_EQ(theirs.size(), 1U);
+  EXPECT_EQ(&*theirs.begin(), c);
+
+  auto node = ours.extract("d");
+  EXPECT_EQ(node.value(), "d");
+  EXPECT_FALSE(ours.contains("d"));
+  EXPECT_TRUE(theirs.insert(std::move(node)).second);
+  EXPECT_TRUE(node.empty());
+  EXPECT_TRUE(ours.extract("zz").empty());
+  EXPECT_EQ(theirs.size(), 2U);
+}
+
+TEST(SetTest, InsertWithHint) {
+  s21::set<int, s21::order_stats::on> s21_set;
+  std::set<int> std_set;
+  std::mt19937 gen(50);
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(gen() % 4000);
+    if (gen() % 4 == 0) {
+      if (std_set.erase(key) != 0) s21_set.erase(key);
+      continue;
+    }
+    // Hints at, next to and far from the key, and the null hint.
+    s21::set<int, s21::order_stats::on>::iterator hint;
+    if (!s21_set.empty() && gen() % 8 != 0) {
+      hint = s21_set.lower_bound(key + static_cast<int>(gen() % 3) - 1);
+      if (gen() % 4 == 0) hint = s21_set.nth_element(gen() % s21_set.size());
+    }
+    auto it = gen() % 2 ? s21_set.insert(hint, key)
+                        : s21_set.emplace_hint(hint, key);
+    std_set.insert(key);
+    EXPECT_EQ(*it, key);
+  }
+  ASSERT_EQ(s21_set.size(), std_set.size());
+  size_t rank = 0;
+  for (int key : std_set) {
+    EXPECT_EQ(*s21_set.nth_element(rank), key);
+    EXPECT_EQ(s21_set.rank(key), rank++);
+  }
+}
+
+TEST(SetTest, HintedInsertKeepsBalance) {
+  CheckHintedInsertKeepsBalance<s21::set<int>>();
+  CheckHintedInsertKeepsBalance<s21::set<int, s21::order_stats::on>>();
+}
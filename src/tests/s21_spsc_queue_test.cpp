@@ -0,0 +1,136 @@
+#include "../s21_spsc_queue/s21_spsc_queue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(SpscQueueTest, CapacityRoundsUp) {
+  s21::spsc_queue<int> q(5);
+  EXPECT_EQ(q.capacity(), 8U);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueTest, PushPopSingleThread) {
+  s21::spsc_queue<std::string> q(4);
+  EXPECT_TRUE(q.try_push("a"));
+  EXPECT_TRUE(q.try_push(std::string("b")));
+  EXPECT_TRUE(q.try_emplace(3, 'c'));
+  EXPECT_TRUE(q.try_push("d"));
+  EXPECT_FALSE(q.try_push("e"));
+  EXPECT_EQ(q.size_approx(), 4U);
+
+  std::string out;
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "a");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "b");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "ccc");
+  EXPECT_TRUE(q.try_push("e"));
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "d");
+  EXPECT_TRUE(q.try_pop(out));
+  EXPECT_EQ(out, "e");
+  EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(SpscQueueTest, Batches) {
+  s21::spsc_queue<int> q(8);
+  int src[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  EXPECT_EQ(q.try_push_n(src, 6), 6U);
+  EXPECT_EQ(q.try_push_n(src + 6, 4), 2U);
+
+  int dst[10] = {};
+  EXPECT_EQ(q.try_pop_n(dst, 5), 5U);
+  EXPECT_EQ(q.try_push_n(src + 8, 2), 2U);
+  EXPECT_EQ(q.try_pop_n(dst + 5, 10), 5U);
+  for (int i = 0; i < 10; ++i) EXPECT_EQ(dst[i], i);
+  EXPECT_EQ(q.try_pop_n(dst, 10), 0U);
+}
+
+TEST(SpscQueueTest, DestroysRemainingElements) {
+  auto shared = std::make_shared<int>(1);
+  {
+    s21::spsc_queue<std::shared_ptr<int>> q(4);
+    q.try_push(shared);
+    q.try_push(shared);
+    EXPECT_EQ(shared.use_count(), 3);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(SpscQueueTest, TwoThreadsKeepOrder) {
+  constexpr int kCount = 200000;
+  s21::spsc_queue<int> q(64);
+  std::thread producer([&q] {
+    int batch[16];
+    int next = 0;
+    while (next < kCount) {
+      if (next % 3 == 0) {
+        int n = 0;
+        for (; n < 16 && next + n < kCount; ++n) batch[n] = next + n;
+        size_t pushed = q.try_push_n(batch, n);
+        if (pushed == 0) std::this_thread::yield();
+        next += static_cast<int>(pushed);
+      } else if (q.try_push(next)) {
+        ++next;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::vector<int> received;
+  received.reserve(kCount);
+  int buf[8];
+  while (static_cast<int>(received.size()) < kCount) {
+    size_t n = q.try_pop_n(buf, 8);
+    for (size_t i = 0; i < n; ++i) received.push_back(buf[i]);
+    int value;
+    if (q.try_pop(value))
+      received.push_back(value);
+    else if (n == 0)
+      std::this_thread::yield();
+  }
+  producer.join();
+  for (int i = 0; i < kCount; ++i) ASSERT_EQ(received[i], i);
+  EXPECT_TRUE(q.empty());
+}
+
+TEST(SpscQueueTest, SizeSeenFromThirdThreadStaysInRange) {
+  // The observer spins without yielding so it is often preempted between
+  // its two loads, which is what a wrong size needs.
+  constexpr int kCount = 20000;
+  s21::spsc_queue<int> q(16);
+  std::atomic<bool> done(false);
+  std::thread producer([&q] {
+    for (int i = 0; i < kCount;) {
+      if (q.try_push(i))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+  });
+  std::thread consumer([&q, &done] {
+    int value;
+    for (int i = 0; i < kCount;) {
+      if (q.try_pop(value))
+        ++i;
+      else
+        std::this_thread::yield();
+    }
+    done = true;
+  });
+  size_t largest = 0;
+  while (!done.load()) {
+    size_t size = q.size_approx();
+    if (size > largest) largest = size;
+  }
+  producer.join();
+  consumer.join();
+  EXPECT_LE(largest, q.capacity());
+  EXPECT_EQ(q.size_approx(), 0U);
+}
@@ -0,0 +1,130 @@
+#include "../s21_timer_wheel/s21_timer_wheel.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+struct Connection : s21::timer {
+  int id = 0;
+};
+
+std::vector<std::pair<uint64_t, int>> Fire(s21::timer_wheel &wheel,
+                                           uint64_t now) {
+  std::vector<std::pair<uint64_t, int>> fired;
+  wheel.advance(now, [&](s21::timer &t) {
+    fired.push_back({wheel.now(), static_cast<Connection &>(t).id});
+  });
+  return fired;
+}
+}  // namespace
+
+TEST(TimerWheelTest, FiresAtDeadline) {
+  s21::timer_wheel wheel;
+  Connection a, b, c;
+  a.id = 1;
+  b.id = 2;
+  c.id = 3;
+  wheel.schedule(a, 5);
+  wheel.schedule(b, 3);
+  wheel.schedule_after(c, 5);
+  EXPECT_TRUE(a.scheduled());
+  EXPECT_EQ(a.deadline(), 5U);
+  EXPECT_TRUE(Fire(wheel, 2).empty());
+  auto fired = Fire(wheel, 10);
+  ASSERT_EQ(fired.size(), 3U);
+  EXPECT_EQ(fired[0], std::make_pair(uint64_t(3), 2));
+  EXPECT_EQ(fired[1], std::make_pair(uint64_t(5), 1));
+  EXPECT_EQ(fired[2], std::make_pair(uint64_t(5), 3));
+  EXPECT_FALSE(a.scheduled());
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheelTest, CancelRescheduleAndDestroy) {
+  s21::timer_wheel wheel(100);
+  Connection a, b;
+  a.id = 1;
+  b.id = 2;
+  wheel.schedule(a, 150);
+  wheel.schedule(b, 150);
+  wheel.cancel(a);
+  EXPECT_FALSE(a.scheduled());
+  wheel.schedule(b, 120);
+  {
+    Connection gone;
+    wheel.schedule(gone, 110);
+  }
+  wheel.schedule(a, 50);  // Already past: fires on the next tick.
+  auto fired = Fire(wheel, 200);
+  ASSERT_EQ(fired.size(), 2U);
+  EXPECT_EQ(fired[0], std::make_pair(uint64_t(101), 1));
+  EXPECT_EQ(fired[1], std::make_pair(uint64_t(120), 2));
+}
+
+TEST(TimerWheelTest, LongHorizonsCascade) {
+  s21::timer_wheel wheel(7);
+  std::vector<std::unique_ptr<Connection>> timers;
+  std::vector<uint64_t> deadlines = {70,      4100,     4103,      262150,
+                                     262151,  16777300, 16777216,
+                                     40000000};
+  for (size_t i = 0; i < deadlines.size(); ++i) {
+    timers.push_back(std::make_unique<Connection>());
+    timers.back()->id = static_cast<int>(i);
+    wheel.schedule(*timers.back(), deadlines[i]);
+  }
+  std::vector<uint64_t> seen;
+  wheel.advance(50000000, [&](s21::timer &t) {
+    EXPECT_EQ(t.deadline(), wheel.now());
+    seen.push_back(wheel.now());
+  });
+  std::sort(deadlines.begin(), deadlines.end());
+  EXPECT_EQ(seen, deadlines);
+}
+
+TEST(TimerWheelTest, CallbackMayReschedule) {
+  s21::timer_wheel wheel;
+  Connection periodic, other;
+  int ticks = 0;
+  wheel.schedule(periodic, 10);
+  wheel.schedule(other, 30);
+  size_t fired = wheel.advance(100, [&](s21::timer &t) {
+    if (&t == &periodic) {
+      ++ticks;
+      wheel.schedule_after(t, 10);
+      wheel.cancel(other);
+    }
+  });
+  EXPECT_EQ(ticks, 10);
+  EXPECT_EQ(fired, 10U);
+  EXPECT_TRUE(periodic.scheduled());
+  EXPECT_FALSE(other.scheduled());
+}
+
+TEST(TimerWheelTest, RandomScheduleMatchesMap) {
+  std::mt19937_64 gen(3);
+  s21::timer_wheel wheel;
+  std::vector<Connection> conns(500);
+  std::multimap<uint64_t, int> expected;
+  for (size_t i = 0; i < conns.size(); ++i) {
+    conns[i].id = static_cast<int>(i);
+    wheel.schedule(conns[i], 1 + gen() % 300000);
+  }
+  // Reschedule half of them.
+  for (size_t i = 0; i < conns.size(); i += 2)
+    wheel.schedule(conns[i], 1 + gen() % 300000);
+  for (const Connection &c : conns) expected.insert({c.deadline(), c.id});
+  std::multimap<uint64_t, int> seen;
+  uint64_t now = 0;
+  while (!wheel.empty()) {
+    now += 1 + gen() % 5000;
+    wheel.advance(now, [&](s21::timer &t) {
+      EXPECT_EQ(t.deadline(), wheel.now());
+      seen.insert({t.deadline(), static_cast<Connection &>(t).id});
+    });
+  }
+  EXPECT_EQ(seen, expected);
+}